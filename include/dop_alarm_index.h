@@ -0,0 +1,37 @@
+#ifndef DOP_ALARM_INDEX_H
+#define DOP_ALARM_INDEX_H
+
+#include "obinexus_dop_core.h"
+
+// Alarm Firing Index
+// Every armed alarm sits in one process-wide min-heap ordered by the local
+// wall-clock time of its next occurrence (or snooze), kept current by the
+// alarm setters. The next alarm to fire is the root; arming, disarming and
+// moving a recurring alarm on cost O(log n). Heap positions live in the
+// cold metadata slot, so no lookup table is needed.
+//
+// The timing wheel still fires alarms on the monotonic clock. The index
+// answers wall-clock questions and, through dop_alarm_index_fire_due(),
+// catches occurrences a wall-clock step or suspend jumped over.
+
+#define DOP_ALARM_INDEX_NONE UINT64_MAX
+
+typedef void (*dop_alarm_fire_t)(dop_component_t* component, void* context);
+
+// Earliest pending alarm and its occurrence, or NULL when none is armed.
+// The pointer is only valid while the caller keeps the alarm alive.
+dop_component_t* dop_alarm_index_next(dop_time_t* fire_time);
+size_t dop_alarm_index_count(void);
+
+// Fires every alarm whose pending occurrence is at or before now, then
+// invokes `fire` (optional) for each. Returns the number fired.
+size_t dop_alarm_index_fire_due(dop_time_t now, dop_alarm_fire_t fire, void* context);
+
+// Index Maintenance (alarm setters hold the component write lock)
+void dop_alarm_index_set(dop_component_t* component, dop_time_t fire_time);
+void dop_alarm_index_remove(dop_component_t* component);
+
+// Pending occurrence of one alarm, or DOP_ALARM_INDEX_NONE
+dop_time_t dop_alarm_index_time(const dop_component_t* component);
+
+#endif // DOP_ALARM_INDEX_H
@@ -0,0 +1,43 @@
+#ifndef DOP_CHECKSUM_H
+#define DOP_CHECKSUM_H
+
+#include "obinexus_dop_core.h"
+#include <stddef.h>
+
+// Checksum Backends
+// Every CRC algorithm has a portable slice-by-8 implementation. On x86 the
+// CPU is probed once: CRC32C uses the SSE4.2 crc32 instruction and CRC32
+// uses PCLMULQDQ folding. Backends of one algorithm produce identical
+// values, so checksums stay verifiable on any host.
+
+uint32_t dop_checksum_compute(dop_checksum_algorithm_t algorithm, const void* data, size_t size);
+// Same value from the slice-by-8 backend, whatever the CPU supports
+uint32_t dop_checksum_compute_portable(dop_checksum_algorithm_t algorithm, const void* data, size_t size);
+
+// Name of the backend selected for an algorithm ("slice-by-8", "sse4.2", "pclmul")
+const char* dop_checksum_backend_name(dop_checksum_algorithm_t algorithm);
+
+// Incremental Field Checksums
+// DOP_CHECKSUM_FIELDWISE is the XOR of a keyed 64-bit mix of every 8-byte
+// word of the data union, so a setter only rehashes the words it touches:
+//
+//     uint32_t before = dop_checksum_field_begin(c, DOP_FIELD(alarm.is_armed));
+//     c->data.alarm.is_armed = true;
+//     dop_checksum_field_commit(c, before, DOP_FIELD(alarm.is_armed));
+//
+// Components recorded under a CRC algorithm fall back to a full recompute
+// in dop_checksum_field_commit(), so the pattern is safe for every component.
+#define DOP_FIELD(member) \
+    offsetof(dop_component_data_t, member), sizeof(((dop_component_data_t*)0)->member)
+#define DOP_FIELD_SPAN(first, last) \
+    offsetof(dop_component_data_t, first), \
+    (offsetof(dop_component_data_t, last) + sizeof(((dop_component_data_t*)0)->last) - \
+     offsetof(dop_component_data_t, first))
+
+// Contribution of the words covering [offset, offset + size) of the data union
+uint32_t dop_checksum_range(const dop_component_t* component, size_t offset, size_t size);
+
+uint32_t dop_checksum_field_begin(const dop_component_t* component, size_t offset, size_t size);
+void dop_checksum_field_commit(dop_component_t* component, uint32_t before, size_t offset, size_t size);
+
+#endif // DOP_CHECKSUM_H
@@ -0,0 +1,139 @@
+#ifndef DOP_COMPONENT_STORE_H
+#define DOP_COMPONENT_STORE_H
+
+#include "obinexus_dop_core.h"
+#include <stddef.h>
+
+// Structure-of-Arrays Component Store
+// Each component type lives in fixed-size shards of homogeneous columns so
+// bulk passes stream through dense arrays. A dop_component_t obtained through
+// dop_store_view() is a view over one slot: it is refreshed from the columns
+// whenever its write lock is taken and written back by the component setters,
+// so a setter never replays state the bulk passes have since moved on.
+
+// Handle layout: [type:2][shard:20][slot:10]
+#define DOP_STORE_SHARD_BITS      10
+#define DOP_STORE_SHARD_CAPACITY  (1u << DOP_STORE_SHARD_BITS)
+#define DOP_STORE_MAX_SHARDS      4096u
+
+#define DOP_HANDLE_TYPE(h)  ((dop_component_type_t)((h) >> 30))
+#define DOP_HANDLE_SHARD(h) (((h) >> DOP_STORE_SHARD_BITS) & 0xFFFFFu)
+#define DOP_HANDLE_SLOT(h)  ((h) & (DOP_STORE_SHARD_CAPACITY - 1))
+#define DOP_HANDLE_MAKE(type, shard, slot) \
+    (((uint32_t)(type) << 30) | ((uint32_t)(shard) << DOP_STORE_SHARD_BITS) | (uint32_t)(slot))
+
+// Slot Flags
+#define DOP_SLOT_LIVE          0x0001u
+#define DOP_SLOT_RUNNING       0x0002u
+#define DOP_SLOT_PAUSED        0x0004u
+#define DOP_SLOT_ARMED         0x0008u
+#define DOP_SLOT_TRIGGERED     0x0010u
+#define DOP_SLOT_EXPIRED       0x0020u
+#define DOP_SLOT_AUTO_RESTART  0x0040u
+#define DOP_SLOT_FORMAT_24H    0x0080u
+#define DOP_SLOT_REPEAT_SHIFT  8           // Alarm repeat days, 7 bits
+#define DOP_SLOT_REPEAT_MASK   0x7F00u
+#define DOP_SLOT_ZONE_SHIFT    16          // Clock timezone id, 16 bits
+
+// Column usage per type:
+//   clock:     time_ms = current time, param = UTC offset in seconds, timezone id in the flags
+//   alarm:     time_ms = current time (last trigger check), target_ms = alarm time,
+//              param = snooze ms, repeat days in the flags
+//   stopwatch: time_ms = current time, start_ms, target_ms = elapsed ms, param = laps,
+//              start_ns = segment start, span_ns = accumulated
+//   timer:     time_ms = current time, start_ms, target_ms = periods, param = missed periods,
+//              start_ns = period start, span_ns = duration, rest_ns = remaining when stopped
+// The *_ns columns are on the monotonic time base (dop_time_monotonic_ns).
+struct dop_snapshot_restore;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    dop_component_type_t type;
+    uint32_t index;
+    struct dop_snapshot_restore* restore;  // Pending snapshot checks (dop_snapshot.h), or NULL
+    uint32_t high_water;       // Slots [0, high_water) have been handed out
+    uint32_t live_count;
+    uint32_t free_count;
+    uint16_t free_slots[DOP_STORE_SHARD_CAPACITY];
+
+    uint64_t time_ms[DOP_STORE_SHARD_CAPACITY];
+    uint64_t start_ms[DOP_STORE_SHARD_CAPACITY];
+    uint64_t target_ms[DOP_STORE_SHARD_CAPACITY];
+    int64_t param[DOP_STORE_SHARD_CAPACITY];
+    uint64_t start_ns[DOP_STORE_SHARD_CAPACITY];
+    uint64_t span_ns[DOP_STORE_SHARD_CAPACITY];
+    uint64_t rest_ns[DOP_STORE_SHARD_CAPACITY];
+    uint32_t flags[DOP_STORE_SHARD_CAPACITY];
+    uint8_t gate[DOP_STORE_SHARD_CAPACITY];
+    uint8_t state[DOP_STORE_SHARD_CAPACITY];
+
+    dop_component_t* views[DOP_STORE_SHARD_CAPACITY];
+} dop_store_shard_t;
+
+typedef struct dop_component_store {
+    pthread_mutex_t mutex;     // Guards slot allocation and shard creation
+    dop_store_shard_t* shards[DOP_COMPONENT_COUNT][DOP_STORE_MAX_SHARDS];
+    _Atomic(uint32_t) shard_count[DOP_COMPONENT_COUNT];  // Release-published; see dop_store_shard_count
+    uint32_t alloc_hint[DOP_COMPONENT_COUNT];
+
+    // Restored stores: shards inside the mapping are not freed on destroy
+    uint8_t* snapshot_base;
+    size_t snapshot_size;
+    struct dop_snapshot_restore* snapshot;
+} dop_component_store_t;
+
+// Store Lifecycle
+dop_component_store_t* dop_store_create(void);
+void dop_store_destroy(dop_component_store_t* store);
+
+// Slot Management
+dop_handle_t dop_store_add(dop_component_store_t* store, dop_component_type_t type);
+int dop_store_remove(dop_component_store_t* store, dop_handle_t handle);
+bool dop_store_contains(const dop_component_store_t* store, dop_handle_t handle);
+size_t dop_store_count(const dop_component_store_t* store, dop_component_type_t type);
+
+// Per-Component Views
+dop_component_t* dop_store_view(dop_component_store_t* store, dop_handle_t handle);
+int dop_store_sync_view(dop_component_t* view);
+int dop_store_refresh_view(dop_component_t* view);   // Caller holds the view's write lock
+int dop_store_sync_gate(const dop_component_t* view, dop_gate_state_t state);
+
+// Shard Access for Bulk Passes
+dop_store_shard_t* dop_store_shard(const dop_component_store_t* store, dop_handle_t handle);
+
+// Shards of a type published so far. Shards are only ever appended, so
+// shards[type][0, count) may be walked without store->mutex.
+uint32_t dop_store_shard_count(const dop_component_store_t* store, dop_component_type_t type);
+
+// Takes shard->mutex, first settling a shard restored from a snapshot.
+// Bulk passes lock shards through these rather than the mutex directly.
+void dop_store_lock_shard(dop_store_shard_t* shard);
+void dop_store_unlock_shard(dop_store_shard_t* shard);
+
+// Checksum a view of the slot would carry (DOP_CHECKSUM_FIELDWISE); caller
+// holds the shard lock or owns a private copy of the shard
+uint32_t dop_store_slot_checksum(const dop_store_shard_t* shard, uint32_t slot);
+
+// Batched Update
+// Applies the per-type update logic to every handle against one time sample
+// (now_ms for wall-clock types; durations sample the monotonic clock once).
+// Consecutive handles in the same shard share one lock acquisition, so callers
+// should pass handles grouped by shard (e.g. sorted). Handles whose state
+// changed (alarm triggered, timer expired) are written to `changed`, which
+// must have room for `count` entries; `changed_count` receives how many.
+int dop_func_update_components(dop_component_store_t* store,
+                               const dop_handle_t* handles, size_t count,
+                               uint64_t now_ms,
+                               dop_handle_t* changed, size_t* changed_count);
+
+// Streams every live slot of a shard; caller holds the shard lock.
+// `changed` must have room for DOP_STORE_SHARD_CAPACITY entries.
+size_t dop_store_update_shard(dop_store_shard_t* shard, uint64_t now_ms, dop_handle_t* changed);
+
+// Bulk Serialization
+// Writes every live slot as one dop_wire stream (dop_wire.h) straight from
+// the columns in a single pass. Returns bytes written, or 0 if `size` is too
+// small; DOP_WIRE_STREAM_SIZE() of the summed dop_store_count() is enough.
+size_t dop_store_serialize(dop_component_store_t* store, void* buffer, size_t size);
+
+#endif // DOP_COMPONENT_STORE_H
@@ -0,0 +1,72 @@
+#ifndef DOP_DEADLINE_H
+#define DOP_DEADLINE_H
+
+#include "obinexus_dop_core.h"
+
+// Deadline-Aware Update Scheduling
+// Each tracked component carries its next meaningful deadline on the
+// monotonic clock, and only components whose deadline has passed are
+// updated. Components with nothing to do (stopped or paused stopwatches,
+// stopped or expired timers, disarmed or triggered one-shot alarms, stopped
+// clocks, closed gates) are idle: they stay out of the heap and cost nothing
+// per pass, so update work scales with activity rather than population.
+//
+//   Clock      next refresh boundary on the wall clock (default 1s)
+//   Stopwatch  next display refresh while running (default 10ms)
+//   Timer      expiry
+//   Alarm      alarm or snooze deadline on the default timing wheel
+//
+// The scheduler cannot see state changed through the component setters;
+// call dop_deadline_touch() after starting, arming, opening a gate and so
+// on. Remove components before destroying them; removal waits for a due
+// pass in progress, so the component may be destroyed as soon as it returns.
+
+#define DOP_DEADLINE_IDLE UINT64_MAX
+
+#define DOP_DEADLINE_CLOCK_REFRESH_NS      1000000000ull
+#define DOP_DEADLINE_STOPWATCH_REFRESH_NS  10000000ull
+
+typedef struct dop_deadline_scheduler dop_deadline_scheduler_t;
+
+typedef struct {
+    size_t tracked;             // Components added
+    size_t scheduled;           // Tracked components with a pending deadline
+    uint64_t updates;           // Updates run by due passes
+    uint64_t passes;            // Due passes that found work
+} dop_deadline_stats_t;
+
+// Scheduler Lifecycle
+dop_deadline_scheduler_t* dop_deadline_scheduler_create(void);
+void dop_deadline_scheduler_destroy(dop_deadline_scheduler_t* scheduler);
+
+// Display refresh interval for clocks and stopwatches; 0 leaves running
+// components of that type idle. Applies from each component's next deadline.
+int dop_deadline_set_refresh(dop_deadline_scheduler_t* scheduler, dop_component_type_t type, uint64_t interval_ns);
+
+// Tracking
+int dop_deadline_add(dop_deadline_scheduler_t* scheduler, dop_component_t* component);
+int dop_deadline_remove(dop_deadline_scheduler_t* scheduler, dop_component_t* component);
+
+// Recomputes the component's deadline from its current state
+int dop_deadline_touch(dop_deadline_scheduler_t* scheduler, dop_component_t* component);
+
+// Pending deadline of one component, or DOP_DEADLINE_IDLE
+uint64_t dop_deadline_of(dop_deadline_scheduler_t* scheduler, const dop_component_t* component);
+
+// Earliest pending deadline, or DOP_DEADLINE_IDLE when every component is idle
+uint64_t dop_deadline_next(dop_deadline_scheduler_t* scheduler);
+
+// Dispatch
+// Updates every component due at or before now_ns and schedules its next
+// deadline. A component is updated at most once per call. Returns the
+// number of components updated.
+size_t dop_deadline_run_due(dop_deadline_scheduler_t* scheduler, uint64_t now_ns);
+
+// Sleeps until the earliest deadline, at most timeout_ms (-1 waits until a
+// deadline exists and passes), then runs everything due. Add and touch wake
+// a sleeping caller when they bring the earliest deadline closer.
+int dop_deadline_run_once(dop_deadline_scheduler_t* scheduler, int timeout_ms, size_t* updated);
+
+int dop_deadline_get_stats(dop_deadline_scheduler_t* scheduler, dop_deadline_stats_t* stats);
+
+#endif // DOP_DEADLINE_H
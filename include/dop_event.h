@@ -0,0 +1,60 @@
+#ifndef DOP_EVENT_H
+#define DOP_EVENT_H
+
+#include "obinexus_dop_core.h"
+#include "dop_timing_wheel.h"
+
+// Expiry Notifications
+// An event loop owns one timerfd, always armed (absolute, CLOCK_MONOTONIC)
+// to the earliest deadline of its timing wheel, and an epoll set holding it.
+// When the timerfd fires the wheel is advanced and every subscriber of a
+// fired component is notified, either through a callback or by bumping an
+// eventfd the consumer can add to its own epoll set. Nothing polls flags.
+
+typedef enum {
+    DOP_EVENT_TIMER_EXPIRED = 1,
+    DOP_EVENT_ALARM_TRIGGERED = 2
+} dop_event_kind_t;
+
+typedef uint32_t dop_subscription_t;
+#define DOP_SUBSCRIPTION_INVALID 0u
+
+// Runs on the dispatching thread; must not subscribe or unsubscribe
+typedef void (*dop_event_callback_t)(dop_component_t* component, dop_event_kind_t kind, void* context);
+
+typedef struct dop_event_loop dop_event_loop_t;
+
+// Loop Lifecycle (wheel NULL selects dop_timing_wheel_default())
+dop_event_loop_t* dop_event_loop_create(dop_timing_wheel_t* wheel);
+void dop_event_loop_destroy(dop_event_loop_t* loop);
+
+// Subscriptions
+// A subscription covers one component or a group of them; the group shares
+// a single callback or eventfd.
+int dop_event_subscribe(dop_event_loop_t* loop,
+                        dop_component_t* const* components, size_t count,
+                        dop_event_callback_t callback, void* context,
+                        dop_subscription_t* subscription);
+
+// Creates a non-blocking eventfd that is incremented once per fired event;
+// the caller owns the descriptor and closes it after unsubscribing.
+int dop_event_subscribe_eventfd(dop_event_loop_t* loop,
+                                dop_component_t* const* components, size_t count,
+                                int* event_fd, dop_subscription_t* subscription);
+
+int dop_event_unsubscribe(dop_event_loop_t* loop, dop_subscription_t subscription);
+
+// Dispatch
+// Waits up to timeout_ms (-1 blocks) for the next deadline and dispatches
+// everything due; `fired` (optional) receives the number of components fired.
+int dop_event_loop_run_once(dop_event_loop_t* loop, int timeout_ms, size_t* fired);
+
+// Background dispatch thread
+int dop_event_loop_start(dop_event_loop_t* loop);
+int dop_event_loop_stop(dop_event_loop_t* loop);
+
+// epoll descriptor, readable whenever a deadline is due; lets callers nest
+// the loop inside their own epoll set and call run_once(loop, 0, ...) on wakeup
+int dop_event_loop_fd(const dop_event_loop_t* loop);
+
+#endif // DOP_EVENT_H
@@ -0,0 +1,86 @@
+#ifndef DOP_JOURNAL_H
+#define DOP_JOURNAL_H
+
+#include "obinexus_dop_core.h"
+
+// Change Journal
+// Gate flips, start/stop, arm/disarm, triggers and expiries are appended as
+// fixed 32-byte events to a ring owned by the recording thread, so producers
+// never share a cache line, take a lock or allocate: an append is a handful
+// of stores and one release. Rings are carved once by dop_journal_init() and
+// claimed by a thread on its first event; the ring of an exited thread goes
+// to the next new one. A full ring drops the new event and counts it, and
+// the gap shows in that ring's sequence numbers.
+//
+// A single consumer drains the rings, receiving contiguous batches straight
+// from ring memory to fan out to audit, replication or metrics sinks.
+// Events of one producer arrive in order; merge producers on timestamp_ns
+// for a global order. Before dop_journal_init() recording is one load.
+
+#define DOP_JOURNAL_MAX_RINGS     1024u
+#define DOP_JOURNAL_MAX_CAPACITY  (1u << 20)
+
+typedef enum {
+    DOP_JOURNAL_GATE = 1,       // value: new dop_gate_state_t
+    DOP_JOURNAL_START = 2,      // Stopwatch or timer started
+    DOP_JOURNAL_RESUME = 3,     // Paused stopwatch running again
+    DOP_JOURNAL_PAUSE = 4,
+    DOP_JOURNAL_STOP = 5,
+    DOP_JOURNAL_RESET = 6,
+    DOP_JOURNAL_ARM = 7,
+    DOP_JOURNAL_DISARM = 8,
+    DOP_JOURNAL_TRIGGER = 9,    // Alarm fired
+    DOP_JOURNAL_SNOOZE = 10,    // value: snooze ms
+    DOP_JOURNAL_EXPIRE = 11     // Timer period ended; value: periods ended (> 1 when late)
+} dop_journal_kind_t;
+
+typedef struct {
+    uint64_t timestamp_ns;      // Monotonic time base (dop_time_monotonic_ns)
+    uint64_t sequence;          // Per producer ring, dropped events included
+    uint32_t cold_index;        // Component metadata slot, or DOP_COLD_INVALID
+    dop_handle_t handle;        // Store slot, or DOP_HANDLE_INVALID
+    uint32_t value;             // Kind-specific, see dop_journal_kind_t
+    uint16_t producer;          // Ring index
+    uint8_t type;               // dop_component_type_t
+    uint8_t kind;               // dop_journal_kind_t
+} dop_journal_event_t;
+
+typedef struct {
+    uint64_t recorded;          // Events appended since init
+    uint64_t pending;           // Appended and not yet drained
+    uint64_t dropped;           // Rejected by a full ring or for want of a free ring
+    uint32_t rings_owned;       // Rings claimed by live threads
+} dop_journal_stats_t;
+
+// Runs on the draining thread with the drain lock held; must not drain.
+// The batch is only valid for the duration of the call.
+typedef void (*dop_journal_consumer_t)(const dop_journal_event_t* events, size_t count, void* context);
+
+// Journal Lifecycle
+// Allocates ring_count rings of ring_capacity events (rounded up to a power
+// of two) and starts recording. Once per process; the rings are never freed,
+// so a second call returns DOP_ERROR_INVALID_STATE.
+int dop_journal_init(uint32_t ring_capacity, uint32_t ring_count);
+
+// Pauses or resumes recording; DOP_ERROR_INVALID_STATE before init
+int dop_journal_set_enabled(bool enabled);
+bool dop_journal_enabled(void);
+
+// Recording (called by the component setters and update paths)
+void dop_journal_record(const dop_component_t* component, dop_journal_kind_t kind, uint32_t value);
+void dop_journal_record_slot(dop_handle_t handle, dop_journal_kind_t kind, uint32_t value);
+
+// Period counts saturate in the 32-bit event value
+static inline uint32_t dop_journal_periods(uint64_t periods) {
+    return periods > UINT32_MAX ? UINT32_MAX : (uint32_t)periods;
+}
+
+// Draining
+// Hands at most max_events pending events to `consumer` in per-ring batches
+// and returns how many were handed. Rings are visited round robin across
+// calls so a capped drain cannot starve the later ones.
+size_t dop_journal_drain(dop_journal_consumer_t consumer, void* context, size_t max_events);
+
+int dop_journal_stats(dop_journal_stats_t* stats);
+
+#endif // DOP_JOURNAL_H
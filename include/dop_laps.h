@@ -0,0 +1,74 @@
+#ifndef DOP_LAPS_H
+#define DOP_LAPS_H
+
+#include "obinexus_dop_core.h"
+
+// Stopwatch Lap History
+// Lap marks are kept in a per-stopwatch ring of configurable depth, carved
+// from a shared arena and referenced from the cold metadata slot, so the
+// data union stays the same size. Each ring also keeps its lap durations
+// in sorted order, so min, max and percentiles are O(1) lookups and the
+// mean is a running sum; nothing is copied to answer a query.
+//
+// Laps are recorded under the component write lock. Statistics are read
+// with the seqlock protocol. A view points straight into the ring and is
+// only stable until the next lap, reset or history change: take it from
+// the thread that records laps, or while the stopwatch is stopped.
+
+#define DOP_LAP_MAX_DEPTH 4096u
+
+typedef enum {
+    DOP_LAP_OVERWRITE_OLDEST = 0,   // Keep the newest `depth` laps
+    DOP_LAP_DROP_NEWEST = 1         // Keep the first `depth` laps
+} dop_lap_overflow_t;
+
+typedef struct {
+    uint64_t split_ns;      // Elapsed time at the mark
+    uint64_t lap_ns;        // Since the previous mark
+} dop_lap_t;
+
+// Held laps, oldest first: first[0..first_count) then second[0..second_count)
+typedef struct {
+    const dop_lap_t* first;
+    size_t first_count;
+    const dop_lap_t* second;
+    size_t second_count;
+} dop_lap_view_t;
+
+typedef struct {
+    size_t count;           // Laps held
+    uint64_t recorded;      // Laps marked since the last reset
+    uint64_t dropped;       // Laps overwritten or rejected by the overflow policy
+    uint64_t min_ns;        // Over held lap durations; 0 when count == 0
+    uint64_t max_ns;
+    uint64_t mean_ns;
+} dop_lap_stats_t;
+
+// History Configuration
+// Depth 0 releases the history. Changing depth or policy clears held laps;
+// the first lap marked afterwards runs from the start of the current run.
+int dop_stopwatch_set_lap_history(dop_component_t* component, uint32_t depth, dop_lap_overflow_t policy);
+
+// Queries
+int dop_stopwatch_lap_view(const dop_component_t* component, dop_lap_view_t* view);
+int dop_stopwatch_lap_stats(const dop_component_t* component, dop_lap_stats_t* stats);
+
+// Nearest-rank percentile (0-100) of held lap durations; 0 when empty
+uint64_t dop_stopwatch_lap_percentile(const dop_component_t* component, double percentile);
+
+static inline const dop_lap_t* dop_lap_view_at(const dop_lap_view_t* view, size_t index) {
+    return index < view->first_count ? &view->first[index] : &view->second[index - view->first_count];
+}
+
+// Ring Internals (used by the stopwatch setters and the metadata table)
+typedef struct dop_lap_ring dop_lap_ring_t;
+
+// Caller holds the component write lock
+void dop_lap_ring_mark(dop_lap_ring_t* ring, uint64_t split_ns);
+void dop_lap_ring_restart(dop_lap_ring_t* ring);
+void dop_lap_ring_clear(dop_lap_ring_t* ring);
+
+// Returns the ring to the arena
+void dop_lap_ring_release(dop_lap_ring_t* ring);
+
+#endif // DOP_LAPS_H
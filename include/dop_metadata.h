@@ -0,0 +1,44 @@
+#ifndef DOP_METADATA_H
+#define DOP_METADATA_H
+
+#include "obinexus_dop_core.h"
+
+// Cold Metadata Side Table
+// Identity and creation time are read for display, manifests and
+// serialization only, so they live outside dop_component_t in chunked slots
+// addressed by metadata.cold_index. Names and versions are interned: every
+// component of a type shares one immutable copy for the process lifetime.
+
+#define DOP_COLD_CHUNK_BITS  10
+#define DOP_COLD_CHUNK_SIZE  (1u << DOP_COLD_CHUNK_BITS)
+#define DOP_COLD_MAX_CHUNKS  4096u
+
+struct dop_lap_ring;
+
+typedef struct {
+    char component_id[64];
+    _Atomic(const char*) component_name;   // Interned
+    _Atomic(const char*) version;          // Interned
+    uint64_t creation_timestamp;
+    _Atomic(struct dop_lap_ring*) lap_ring;  // Stopwatch lap history (dop_laps.h), or NULL
+    uint32_t alarm_position;               // Alarm index heap slot (dop_alarm_index.h), or UINT32_MAX
+    uint32_t next_free;
+} dop_component_cold_t;
+
+// String Interning
+// Returns a process-lifetime copy shared by all equal strings, or NULL on
+// allocation failure.
+const char* dop_intern_string(const char* text);
+
+// Side-Table Slots
+uint32_t dop_metadata_acquire(void);
+void dop_metadata_release(uint32_t cold_index);
+dop_component_cold_t* dop_metadata_cold(uint32_t cold_index);
+
+// Batched slots for bulk create/destroy; one lock round trip per call.
+// Clone gives each component its own slot holding a copy of source_index
+// and returns how many leading components were filled.
+size_t dop_metadata_clone(uint32_t source_index, dop_component_t* const* components, size_t count);
+void dop_metadata_release_batch(dop_component_t* const* components, size_t count);
+
+#endif // DOP_METADATA_H
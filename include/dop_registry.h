@@ -0,0 +1,33 @@
+#ifndef DOP_REGISTRY_H
+#define DOP_REGISTRY_H
+
+#include "obinexus_dop_core.h"
+
+// Component Registry
+// Every live component with a cold slot is registered under its
+// component_id. Generated IDs take the form comp_<type>_<serial> from a
+// process-wide atomic counter, so they never collide. Lookups are lock-free
+// probes of an open-addressing table; binding and removal serialize on a
+// writer lock. Each binding publishes an immutable copy of the ID, so a
+// probe never reads a component's ID while a rebind rewrites it. Unbound IDs
+// are pooled for reuse, and replaced tables freed, only after every lookup
+// that could still see them has left its read epoch. A component must not be destroyed while
+// another thread may still be using a pointer that lookup returned.
+
+// Generated identity
+uint64_t dop_registry_next_serial(void);
+int dop_registry_assign(dop_component_t* component);
+size_t dop_registry_assign_batch(dop_component_t* const* components, size_t count);
+
+// Binds component_id to the component, replacing its previous binding.
+// Fails with DOP_ERROR_INVALID_STATE if another component holds the ID.
+int dop_registry_bind(dop_component_t* component, const char* component_id);
+void dop_registry_remove(const dop_component_t* component);
+void dop_registry_remove_batch(dop_component_t* const* components, size_t count);
+
+// Lookup
+dop_component_t* dop_registry_lookup(const char* component_id);
+dop_handle_t dop_registry_resolve(const char* component_id);   // DOP_HANDLE_INVALID unless store-backed
+size_t dop_registry_count(void);
+
+#endif // DOP_REGISTRY_H
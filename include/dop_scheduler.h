@@ -0,0 +1,60 @@
+#ifndef DOP_SCHEDULER_H
+#define DOP_SCHEDULER_H
+
+#include "obinexus_dop_core.h"
+
+// Work-Stealing Scheduler
+// A parallel-for over a component array. The range is split in halves
+// down to `grain` components; each worker keeps its halves on its own
+// Chase-Lev deque, works them LIFO, and steals the oldest (largest) half
+// from a random victim when it runs dry. The calling thread takes part as
+// worker 0, so a scheduler with one worker runs the loop inline.
+//
+// One parallel-for runs at a time per scheduler; calls from other threads
+// wait their turn. Range functions must not start a parallel-for on the
+// scheduler that is running them.
+
+#define DOP_SCHEDULER_DEFAULT_GRAIN 256u
+
+typedef struct dop_scheduler dop_scheduler_t;
+
+// Processes components[begin, end)
+typedef void (*dop_range_fn_t)(dop_component_t* const* components, size_t begin, size_t end, void* context);
+
+typedef struct {
+    uint64_t ranges;            // Ranges executed
+    uint64_t steals;            // Ranges taken from another worker
+} dop_scheduler_worker_stats_t;
+
+// Scheduler Lifecycle
+// worker_count 0 uses one worker per online CPU
+dop_scheduler_t* dop_scheduler_create(uint32_t worker_count);
+void dop_scheduler_destroy(dop_scheduler_t* scheduler);
+uint32_t dop_scheduler_worker_count(const dop_scheduler_t* scheduler);
+
+// Parallel-For
+// grain 0 uses DOP_SCHEDULER_DEFAULT_GRAIN. Returns once every range has run.
+int dop_parallel_for(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                     size_t grain, dop_range_fn_t fn, void* context);
+
+// Component Jobs
+// Update runs dop_func_update_component(); `updated` (optional) receives
+// the number that accepted the update, which skips closed gates.
+int dop_parallel_update(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                        size_t* updated);
+
+// Fails with DOP_ERROR_CHECKSUM_FAILED if any checksum does not verify;
+// `failed` (optional) receives how many
+int dop_parallel_validate(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                          size_t* failed);
+
+// Writes the same stream as dop_wire_serialize_iov() into one buffer,
+// record i holding component i. Returns bytes written, or 0 if `size` is
+// less than DOP_WIRE_STREAM_SIZE(count).
+size_t dop_parallel_serialize(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                              void* buffer, size_t size);
+
+int dop_scheduler_worker_stats(const dop_scheduler_t* scheduler, uint32_t worker,
+                               dop_scheduler_worker_stats_t* stats);
+
+#endif // DOP_SCHEDULER_H
@@ -0,0 +1,33 @@
+#ifndef DOP_SLAB_H
+#define DOP_SLAB_H
+
+#include "obinexus_dop_core.h"
+
+// Per-Type Component Slabs
+// Components are carved from cache-line aligned slabs of DOP_SLAB_OBJECTS.
+// Each thread keeps a small free list per type, so steady create/destroy
+// churn touches neither malloc nor a shared lock; threads exchange objects
+// with the type's shared pool in batches of DOP_SLAB_BATCH. Slab memory is
+// retained for reuse for the life of the process.
+
+#define DOP_SLAB_OBJECTS     64u
+#define DOP_SLAB_BATCH       32u
+#define DOP_SLAB_CACHE_MAX   (2u * DOP_SLAB_BATCH)
+
+typedef struct {
+    size_t live;        // Components currently handed out
+    size_t peak;        // High-water mark of live
+    size_t capacity;    // Objects backed by slabs
+} dop_slab_stats_t;
+
+// Raw object allocation (uninitialized; see dop_component_init)
+dop_component_t* dop_slab_alloc(dop_component_type_t type);
+void dop_slab_free(dop_component_t* component);
+
+// Batched variants; alloc returns how many of `count` were allocated
+size_t dop_slab_alloc_batch(dop_component_type_t type, dop_component_t** components, size_t count);
+void dop_slab_free_batch(dop_component_t* const* components, size_t count);
+
+int dop_slab_get_stats(dop_component_type_t type, dop_slab_stats_t* stats);
+
+#endif // DOP_SLAB_H
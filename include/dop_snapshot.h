@@ -0,0 +1,68 @@
+#ifndef DOP_SNAPSHOT_H
+#define DOP_SNAPSHOT_H
+
+#include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+#include "dop_tz.h"
+
+// Store Snapshots
+// A snapshot holds a component store's shards verbatim: every column, gate
+// and state byte, plus one checksum per slot. Each shard image starts on
+// its own page and contains no pointers, so restore maps the file
+// copy-on-write and the store adopts the shard images where they lie.
+// Restore costs O(shards), not O(components). Handles survive the restart;
+// views, identity strings and lap histories do not.
+//
+// Restored shards are settled on first use, under the shard lock. This
+// checks each live slot against its checksum and isolates any that fail:
+// gate DOP_GATE_ISOLATED, state DOP_STATE_ERROR. It also moves running
+// spans onto this boot's monotonic clock and rebinds clock zones by name.
+// dop_snapshot_verify() settles everything up front across threads.
+//
+// Images use the host layout of dop_store_shard_t. Move state between
+// builds or architectures with dop_store_serialize() instead.
+
+#define DOP_SNAPSHOT_MAGIC    0x53504F44u    // "DOPS"
+#define DOP_SNAPSHOT_VERSION  1u
+#define DOP_SNAPSHOT_ALIGN    4096u          // Shard images are page-aligned
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t checksum_algorithm;            // dop_checksum_algorithm_t of the slot checksums
+    uint32_t shard_size;                    // sizeof(dop_store_shard_t) of the writer
+    uint32_t shard_capacity;                // DOP_STORE_SHARD_CAPACITY of the writer
+    uint32_t shard_count[DOP_COMPONENT_COUNT];
+    uint32_t zone_count;                    // Zone names for ids 1..zone_count
+    uint32_t reserved;
+    uint64_t sampled_ns;                    // Writer's monotonic clock when taken
+    uint64_t sampled_ms;                    // Wall clock at the same instant
+    uint64_t zones_offset;                  // char[zone_count][DOP_TZ_NAME_MAX]
+    uint64_t checksums_offset;              // uint32_t[shards][shard_capacity]
+    uint64_t shards_offset;                 // Shard images, type-major, DOP_SNAPSHOT_ALIGN apart
+    uint64_t shard_stride;
+    uint64_t file_size;
+} dop_snapshot_header_t;
+
+// Writing
+// Takes each shard under its lock while holding the store lock, writes to
+// `path` through a temporary file and renames it into place once synced.
+int dop_snapshot_write(dop_component_store_t* store, const char* path);
+
+// Restore
+// Maps `path` and returns a store over it. DOP_ERROR_INVALID_STATE for a
+// missing, truncated or foreign file. Destroying the store unmaps it.
+int dop_snapshot_restore(const char* path, dop_component_store_t** store);
+
+// Settles every pending shard on worker_count threads (0: one per online
+// CPU). Fails with DOP_ERROR_CHECKSUM_FAILED if any slot of the snapshot
+// did not verify, lazily or here; `failed` (optional) receives how many.
+int dop_snapshot_verify(dop_component_store_t* store, uint32_t worker_count, size_t* failed);
+
+// Settles one shard; called by dop_store_lock_shard() with the lock held
+void dop_snapshot_settle_shard(dop_store_shard_t* shard);
+
+// Unmaps a restored store's file; called by dop_store_destroy()
+void dop_snapshot_release(dop_component_store_t* store);
+
+#endif // DOP_SNAPSHOT_H
@@ -0,0 +1,63 @@
+#ifndef DOP_TICK_H
+#define DOP_TICK_H
+
+#include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+
+// Sharded Tick Engine
+// Components are partitioned into shards, one worker thread per shard, each
+// pinned to its own CPU when there are enough of them. Every tick a worker
+// runs dop_func_update_component() over its shard, plus its share of an
+// attached store's shards through dop_store_update_shard(); the triggers and
+// expiries those passes cause reach consumers through the change journal
+// (dop_journal.h). Ticks are paced against absolute monotonic deadlines, so
+// the rate does not drift; a worker that overruns skips the missed ticks
+// instead of bursting.
+//
+// Stop returns as soon as every worker has left its current component.
+// Drain runs one final pass on every shard before stopping, so state
+// written before the call is reflected in all components.
+
+#define DOP_TICK_DEFAULT_HZ 100u
+#define DOP_TICK_MAX_HZ     1000000000u     // One tick per nanosecond
+
+typedef struct dop_tick_engine dop_tick_engine_t;
+
+typedef struct {
+    uint64_t ticks;             // Passes completed by this shard
+    uint64_t missed_ticks;      // Ticks skipped after an overrun
+    size_t component_count;
+    int cpu;                    // Pinned CPU, or -1
+} dop_tick_shard_stats_t;
+
+// Engine Lifecycle
+// shard_count 0 uses one shard per online CPU; tick_hz 0 uses DOP_TICK_DEFAULT_HZ.
+// Rates above DOP_TICK_MAX_HZ are rejected here and by set_rate.
+dop_tick_engine_t* dop_tick_engine_create(uint32_t shard_count, uint32_t tick_hz);
+void dop_tick_engine_destroy(dop_tick_engine_t* engine);
+uint32_t dop_tick_engine_shard_count(const dop_tick_engine_t* engine);
+
+// Placement
+// dop_tick_engine_add() picks the least loaded shard and returns its index
+// through `shard` (optional). Components may be added while running.
+int dop_tick_engine_add(dop_tick_engine_t* engine, dop_component_t* component, uint32_t* shard);
+int dop_tick_engine_add_to_shard(dop_tick_engine_t* engine, dop_component_t* component, uint32_t shard);
+int dop_tick_engine_remove(dop_tick_engine_t* engine, dop_component_t* component);
+
+// Store shard i is ticked by worker i % shard_count; NULL detaches
+int dop_tick_engine_attach_store(dop_tick_engine_t* engine, dop_component_store_t* store);
+
+// Node i of the topology goes to shard i % shard_count. While the engine
+// runs, each node's worker_thread is the thread that ticks it.
+int dop_tick_engine_attach_topology(dop_tick_engine_t* engine, dop_build_topology_t* topology);
+
+// Control
+int dop_tick_engine_start(dop_tick_engine_t* engine);
+int dop_tick_engine_stop(dop_tick_engine_t* engine);
+int dop_tick_engine_drain(dop_tick_engine_t* engine);
+int dop_tick_engine_set_rate(dop_tick_engine_t* engine, uint32_t tick_hz);
+bool dop_tick_engine_is_running(const dop_tick_engine_t* engine);
+
+int dop_tick_engine_shard_stats(const dop_tick_engine_t* engine, uint32_t shard, dop_tick_shard_stats_t* stats);
+
+#endif // DOP_TICK_H
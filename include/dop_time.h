@@ -0,0 +1,29 @@
+#ifndef DOP_TIME_H
+#define DOP_TIME_H
+
+#include "obinexus_dop_core.h"
+
+// Time Source
+// Timestamps come from clock_gettime(), which is served from the vDSO on
+// Linux. Calendar fields are derived from a per-thread UTC offset cached per
+// 15-minute window and refreshed only when the window or the timezone
+// changes, so dop_time_hours() and friends are arithmetic on the hot path and
+// remain lock-free and reentrant.
+
+uint64_t dop_time_realtime_ms(void);
+uint64_t dop_time_monotonic_ms(void);
+
+// Duration time base for stopwatches and timers: CLOCK_MONOTONIC in ns.
+// Immune to wall-clock steps and shared with the timing wheel and timerfd,
+// so dop_time_monotonic_ms() == dop_time_monotonic_ns() / 1000000.
+uint64_t dop_time_monotonic_ns(void);
+#define DOP_NS_PER_MS 1000000ull
+
+// Process timezone offset from UTC in seconds east at an instant
+int32_t dop_time_utc_offset(dop_time_t time);
+
+// Re-reads TZ and invalidates every thread's cached decomposition.
+// Call after changing the process timezone.
+void dop_time_tz_changed(void);
+
+#endif // DOP_TIME_H
@@ -0,0 +1,88 @@
+#ifndef DOP_TIMING_WHEEL_H
+#define DOP_TIMING_WHEEL_H
+
+#include "obinexus_dop_core.h"
+
+// Hierarchical Timing Wheel
+// Four levels on the monotonic clock: 1000 x 1ms, 60 x 1s, 60 x 1min and
+// 24 x 1h, plus an overflow list for deadlines beyond a day. Entries are
+// intrusive (dop_component_t.wheel_entry), so scheduling and cancelling are
+// O(1) without allocation, and advancing costs O(expired) plus amortized
+// cascading. Empty levels are skipped, so idle stretches cost nothing.
+// The earliest deadline is cached and, once the entry holding it leaves,
+// found again from per-bucket occupancy bits and a walk of one bucket.
+
+#define DOP_WHEEL_LEVELS       4
+#define DOP_WHEEL_UNSCHEDULED  0xFFFFFFFFu
+
+typedef void (*dop_wheel_fire_t)(dop_component_t* component, void* context);
+
+// Invoked under the wheel lock whenever the earliest pending deadline moves
+// (UINT64_MAX when the wheel is empty); used to arm an external timer source.
+typedef void (*dop_wheel_notify_t)(uint64_t next_deadline_ms, void* context);
+
+typedef struct {
+    dop_wheel_entry_t head;    // Circular sentinel
+} dop_wheel_bucket_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t unpinned;   // Signalled when a fired batch is done with its components
+    uint64_t now_ms;           // Wheel time; everything <= now_ms has fired
+    uint32_t level_count[DOP_WHEEL_LEVELS];
+    uint32_t scheduled;
+    uint64_t occupied[19];     // Non-empty buckets: level0 in words 0-15, levels 1-3 in 16-18
+    uint64_t next_ms;          // Earliest deadline, while next_valid
+    bool next_valid;
+
+    dop_wheel_notify_t notify;
+    void* notify_context;
+    uint64_t notify_ms;        // Deadline last reported through notify
+
+    dop_wheel_bucket_t level0[1000];
+    dop_wheel_bucket_t level1[60];
+    dop_wheel_bucket_t level2[60];
+    dop_wheel_bucket_t level3[24];
+    dop_wheel_bucket_t overflow;
+    dop_wheel_bucket_t due;    // Deadlines already in the past when scheduled
+} dop_timing_wheel_t;
+
+// Wheel Lifecycle
+dop_timing_wheel_t* dop_timing_wheel_create(uint64_t now_ms);
+void dop_timing_wheel_destroy(dop_timing_wheel_t* wheel);
+
+// Process-wide wheel used by the timer and alarm setters
+dop_timing_wheel_t* dop_timing_wheel_default(void);
+
+// Scheduling (deadlines are monotonic milliseconds)
+int dop_timing_wheel_schedule(dop_timing_wheel_t* wheel, dop_component_t* component, uint64_t deadline_ms);
+// Schedules count components under one lock acquisition
+int dop_timing_wheel_schedule_batch(dop_timing_wheel_t* wheel, dop_component_t* const* components,
+                                    const uint64_t* deadlines_ms, size_t count);
+int dop_timing_wheel_cancel(dop_timing_wheel_t* wheel, dop_component_t* component);
+bool dop_timing_wheel_is_scheduled(const dop_component_t* component);
+
+// Unschedules a component about to be freed and waits until no advance is
+// still firing it. Called by the destroy paths; a fire callback may destroy
+// components of its own batch, which are then skipped.
+void dop_timing_wheel_release(dop_timing_wheel_t* wheel, dop_component_t* component);
+void dop_timing_wheel_release_batch(dop_timing_wheel_t* wheel, dop_component_t* const* components, size_t count);
+
+// Pending deadline of one component, or UINT64_MAX when it is not scheduled
+uint64_t dop_timing_wheel_deadline(dop_timing_wheel_t* wheel, const dop_component_t* component);
+
+// Driver: fires every entry due at or before now_ms. Timers are expired in
+// one batch and alarms triggered before `fire` (optional) is invoked for
+// each component; periodic timers come back already rescheduled. Fired
+// components stay pinned until their callbacks return.
+// Returns the number of components fired.
+size_t dop_timing_wheel_advance(dop_timing_wheel_t* wheel, uint64_t now_ms,
+                                dop_wheel_fire_t fire, void* context);
+
+// Attach (or with NULL, detach) the deadline notification hook
+int dop_timing_wheel_set_notify(dop_timing_wheel_t* wheel, dop_wheel_notify_t notify, void* context);
+
+// Earliest pending deadline, or UINT64_MAX when nothing is scheduled
+uint64_t dop_timing_wheel_next_deadline(dop_timing_wheel_t* wheel);
+
+#endif // DOP_TIMING_WHEEL_H
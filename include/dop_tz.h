@@ -0,0 +1,36 @@
+#ifndef DOP_TZ_H
+#define DOP_TZ_H
+
+#include "obinexus_dop_core.h"
+
+// Timezone Tables
+// Zones are compiled once per process from the system TZif files
+// ($TZDIR, else /usr/share/zoneinfo) into a sorted array of UTC transition
+// instants and the offset that starts at each. The zone's POSIX rule for
+// times past the recorded history is expanded up to DOP_TZ_RULE_LAST_YEAR
+// at load time, so a lookup is a binary search with a per-zone hint for
+// the common case of repeated instants in the same stretch, and never a
+// localtime_r() call. Tables are immutable once published and never freed.
+//
+// Zone ids are process-local: persist or transmit the name, not the id.
+
+#define DOP_TZ_NAME_MAX        32u      // Longest tzdata name is 32 bytes
+#define DOP_TZ_MAX_ZONES       1024u
+#define DOP_TZ_RULE_LAST_YEAR  2100
+
+// Loads a zone such as "America/New_York" (once per process) and returns
+// its id through `zone`. Returns DOP_ERROR_INVALID_PARAMETER for malformed
+// names and DOP_ERROR_INVALID_STATE when the file is missing or invalid.
+int dop_tz_load(const char* name, uint16_t* zone);
+
+// Name of a loaded zone, or NULL
+const char* dop_tz_name(uint16_t zone);
+
+// Offset from UTC in seconds east in effect at an instant. DOP_TZ_LOCAL
+// resolves through the process timezone; unknown ids give 0.
+int32_t dop_tz_offset(uint16_t zone, dop_time_t instant);
+
+// One instant in many zones, e.g. every clock of a world-clock wall
+void dop_tz_offset_batch(const uint16_t* zones, size_t count, dop_time_t instant, int32_t* offsets);
+
+#endif // DOP_TZ_H
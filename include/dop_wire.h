@@ -0,0 +1,157 @@
+#ifndef DOP_WIRE_H
+#define DOP_WIRE_H
+
+#include "obinexus_dop_core.h"
+#include "dop_tz.h"
+#include <stddef.h>
+#include <sys/uio.h>
+
+// Binary Wire Format
+// One component is one fixed 128-byte little-endian record. A stream is a
+// 16-byte header followed by packed records, so a received buffer can be
+// read in place: dop_wire_stream_records() validates the header and returns
+// the record array without copying. Multi-byte fields are little-endian;
+// read them through dop_wire_le16/32/64(), which are no-ops on
+// little-endian hosts. Encoding never allocates.
+//
+// The *_ns payload fields are on the sender's monotonic time base;
+// dop_wire_apply() rebases running stopwatches and timers through
+// sampled_ns so they keep their elapsed time on the receiving host.
+//
+// Clock zones travel by name, since zone ids are process-local. The record
+// checksum is computed with timezone_id cleared for the same reason.
+
+#define DOP_WIRE_VERSION      1u
+#define DOP_WIRE_MAGIC        0x57504F44u    // "DOPW"
+#define DOP_WIRE_ID_SIZE      48u
+
+#define DOP_WIRE_TZ_LOCAL     0u
+#define DOP_WIRE_TZ_FIXED     1u
+#define DOP_WIRE_TZ_NAMED     2u
+
+typedef struct {
+    uint8_t wire_version;
+    uint8_t type;
+    uint8_t state;
+    uint8_t gate;
+    uint8_t checksum_algorithm;
+    uint8_t id_length;
+    uint16_t reserved;
+    uint32_t checksum;              // Over the decoded data, using checksum_algorithm
+    uint32_t handle;                // Store handle, or DOP_HANDLE_INVALID
+    uint64_t last_update_timestamp;
+    uint64_t sampled_ns;            // Sender's monotonic clock when encoded
+    union {
+        struct {
+            uint64_t alarm_time;
+            uint64_t current_time;
+            uint32_t snooze_duration_ms;
+            uint8_t is_armed;
+            uint8_t is_triggered;
+            uint8_t repeat_days;
+        } alarm;
+        struct {
+            uint64_t current_time;
+            int32_t timezone_offset;
+            uint8_t is_running;
+            uint8_t is_24_hour_format;
+            uint8_t timezone_kind;      // DOP_WIRE_TZ_*
+            uint8_t reserved;
+            char timezone[DOP_TZ_NAME_MAX];  // Zone name for DOP_WIRE_TZ_NAMED, NUL-padded
+        } clock;
+        struct {
+            uint64_t start_time;
+            uint64_t current_time;
+            uint64_t elapsed_ms;
+            uint64_t start_ns;
+            uint64_t accumulated_ns;
+            uint32_t lap_count;
+            uint8_t is_running;
+            uint8_t is_paused;
+        } stopwatch;
+        struct {
+            uint64_t start_time;
+            uint64_t start_ns;
+            uint64_t duration_ns;
+            uint64_t remaining_ns;
+            uint8_t is_running;
+            uint8_t is_expired;
+            uint8_t auto_restart;
+            uint8_t reserved;
+            uint32_t missed_periods;
+            uint64_t periods;
+        } timer;
+        uint8_t bytes[48];
+    } data;
+    char component_id[DOP_WIRE_ID_SIZE];    // Not NUL-terminated when id_length == DOP_WIRE_ID_SIZE
+} dop_wire_record_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t wire_version;
+    uint16_t record_size;
+    uint32_t record_count;
+    uint32_t reserved;
+} dop_wire_header_t;
+
+_Static_assert(sizeof(dop_wire_record_t) == 128, "wire record layout is fixed");
+_Static_assert(sizeof(dop_wire_header_t) == 16, "wire header layout is fixed");
+
+#define DOP_WIRE_RECORD_SIZE  sizeof(dop_wire_record_t)
+#define DOP_WIRE_STREAM_SIZE(count) (sizeof(dop_wire_header_t) + (size_t)(count) * DOP_WIRE_RECORD_SIZE)
+
+// Byte Order
+static inline uint16_t dop_wire_le16(uint16_t value) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return __builtin_bswap16(value);
+#else
+    return value;
+#endif
+}
+
+static inline uint32_t dop_wire_le32(uint32_t value) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return __builtin_bswap32(value);
+#else
+    return value;
+#endif
+}
+
+static inline uint64_t dop_wire_le64(uint64_t value) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return __builtin_bswap64(value);
+#else
+    return value;
+#endif
+}
+
+// Encoding
+// Single records take a consistent snapshot of the component's data.
+int dop_wire_encode(const dop_component_t* component, dop_wire_record_t* record);
+size_t dop_wire_serialize(const dop_component_t* component, void* buffer, size_t size);
+
+// Writes a stream of `count` components across the iovec segments in
+// order; records may straddle segment boundaries. Returns bytes written,
+// or 0 if the segments hold less than DOP_WIRE_STREAM_SIZE(count).
+size_t dop_wire_serialize_iov(const dop_component_t* const* components, size_t count,
+                              const struct iovec* iov, int iov_count);
+
+// Building blocks for bulk writers (see dop_store_serialize): pack data
+// the caller already snapshotted, sharing one sampled_ns per stream
+void dop_wire_pack(dop_wire_record_t* record, const dop_component_t* component,
+                   const dop_component_data_t* data, uint64_t sampled_ns);
+void dop_wire_header_init(dop_wire_header_t* header, uint32_t record_count);
+
+// Zero-Copy Decoding
+// Both return pointers into `buffer`, which must be 8-byte aligned.
+const dop_wire_record_t* dop_wire_record_view(const void* buffer, size_t size);
+const dop_wire_record_t* dop_wire_stream_records(const void* buffer, size_t size, uint32_t* record_count);
+
+// Expands a record's payload; fails with DOP_ERROR_CHECKSUM_FAILED if the
+// payload does not match the recorded checksum.
+int dop_wire_decode_data(const dop_wire_record_t* record, dop_component_data_t* data);
+
+// Applies a record's payload, state and gate to a component of the same type
+int dop_wire_apply(const dop_wire_record_t* record, dop_component_t* component);
+
+#endif // DOP_WIRE_H
@@ -10,6 +10,7 @@
 #include <time.h>
 #include <pthread.h>
 #include <stdio.h>
+#include <stddef.h>
 // Data-Oriented Programming Core Types
 typedef enum {
     DOP_COMPONENT_ALARM = 0,
@@ -44,52 +45,85 @@ typedef struct {
     bool is_valid;
 } dop_time_data_t;
 
+// Packed wall-clock time: epoch milliseconds only. Calendar fields are
+// derived on demand (dop_time_hours() etc.); dop_time_data_t remains the
+// expanded form at API boundaries (dop_time_to_data/dop_time_from_data).
+typedef uint64_t dop_time_t;
+
 typedef struct {
-    dop_time_data_t alarm_time;
-    dop_time_data_t current_time;
+    dop_time_t alarm_time;
+    dop_time_t current_time;
     bool is_armed;
     bool is_triggered;
+    uint8_t repeat_days;     // DOP_ALARM_DAY() mask; 0 = one-shot
     uint32_t snooze_duration_ms;
 } dop_alarm_data_t;
 
+// Clock zones: the process timezone, a fixed offset, or a dop_tz.h table
+#define DOP_TZ_LOCAL  0u
+#define DOP_TZ_FIXED  0xFFFFu
+
 typedef struct {
-    dop_time_data_t current_time;
+    dop_time_t current_time;
     bool is_running;
-    uint32_t timezone_offset;
+    int32_t timezone_offset;    // Seconds east of UTC in effect at current_time
     bool is_24_hour_format;
+    uint16_t timezone_id;       // DOP_TZ_LOCAL, DOP_TZ_FIXED or a loaded zone
 } dop_clock_data_t;
 
 typedef struct {
-    dop_time_data_t start_time;
-    dop_time_data_t current_time;
-    dop_time_data_t elapsed_time;
+    dop_time_t start_time;
+    dop_time_t current_time;
+    uint64_t elapsed_ms;     // Display value refreshed by the update pass
     bool is_running;
     bool is_paused;
     uint32_t lap_count;
+    uint64_t start_ns;       // Monotonic start of the current running segment
+    uint64_t accumulated_ns; // Elapsed before start_ns, pauses excluded
 } dop_stopwatch_data_t;
 
 typedef struct {
-    dop_time_data_t start_time;
-    dop_time_data_t duration;
-    dop_time_data_t remaining;
+    dop_time_t start_time;
     bool is_running;
     bool is_expired;
-    bool auto_restart;
+    bool auto_restart;       // Periodic: rearms from the scheduled deadline
+    uint32_t missed_periods; // Periods that ended without being observed
+    uint64_t start_ns;       // Monotonic start of the current period
+    uint64_t duration_ns;    // One-shot duration or period
+    uint64_t remaining_ns;   // Frozen while not running
+    uint64_t periods;        // Periods completed since start, missed ones included
 } dop_timer_data_t;
 
 // Component Metadata (Separated from Logic)
+// Only the state touched per tick lives here. Identity strings and the
+// creation time are cold and live in the metadata side table
+// (dop_metadata.h), reached through dop_component_id() and friends.
 typedef struct {
-    char component_id[64];
-    char component_name[128];
-    char version[32];
     dop_component_type_t type;
     dop_component_state_t state;
-    dop_gate_state_t gate_state;
-    uint64_t creation_timestamp;
+    _Atomic(dop_gate_state_t) gate_state; // Acquire/release; see dop_gate_*
+    uint32_t cold_index; // Side-table slot, or DOP_COLD_INVALID
     uint64_t last_update_timestamp;
-    pthread_mutex_t mutex;
 } dop_component_metadata_t;
 
+#define DOP_COLD_INVALID 0xFFFFFFFFu
+#define DOP_CACHE_LINE 64
+
+// Component Store Handle (see dop_component_store.h)
+typedef uint32_t dop_handle_t;
+#define DOP_HANDLE_INVALID 0xFFFFFFFFu
+
+struct dop_component_store;
+
+// Timing Wheel Linkage (see dop_timing_wheel.h)
+typedef struct dop_wheel_entry {
+    struct dop_wheel_entry* next;
+    struct dop_wheel_entry* prev;
+    uint64_t deadline_ms;       // Monotonic milliseconds
+    uint32_t bucket;            // Wheel bucket index, or DOP_WHEEL_UNSCHEDULED
+    uint32_t pins;              // Advances still firing the component
+} dop_wheel_entry_t;
+
 // Unified Component Data Union
 typedef union {
     dop_alarm_data_t alarm;
@@ -99,10 +133,17 @@ typedef union {
 } dop_component_data_t;
 
 // Complete Component Structure
+// Hot block first and cache-line aligned: metadata, sequence, checksum and
+// data are what tick and read paths touch. Linkage follows.
 typedef struct {
-    dop_component_metadata_t metadata;
-    dop_component_data_t data;
+    _Alignas(DOP_CACHE_LINE) dop_component_metadata_t metadata;
+    _Atomic(uint32_t) sequence; // Seqlock: odd while a writer holds the component
     uint32_t checksum; // For integrity validation
+    dop_component_data_t data;
+    uint8_t checksum_algorithm; // dop_checksum_algorithm_t used for checksum
+    dop_handle_t handle;
+    struct dop_component_store* store; // Backing store when used as a view
+    dop_wheel_entry_t wheel_entry; // Pending timer/alarm deadline
 } dop_component_t;
 
 // Function Pointer Types (Behavior Separation)
@@ -144,10 +185,17 @@ typedef struct {
 // Core Function Declarations
 // Functional Programming Interface
 dop_component_t* dop_func_create_component(dop_component_type_t type);
+int dop_component_init(dop_component_t* component, dop_component_type_t type);
 int dop_func_update_component(dop_component_t* component);
 int dop_func_destroy_component(dop_component_t* component);
 char* dop_func_serialize_component(const dop_component_t* component);
 
+// Bulk lifecycle: components share one initialization and are drawn from
+// and returned to the per-type slabs in batches. Create fills components[]
+// and returns how many were created; unfilled entries are set to NULL.
+size_t dop_func_create_components(dop_component_type_t type, dop_component_t** components, size_t count);
+void dop_func_destroy_components(dop_component_t* const* components, size_t count);
+
 // Object-Oriented Programming Interface
 dop_oop_interface_t* dop_oop_create_interface(dop_component_type_t type);
 int dop_oop_destroy_interface(dop_oop_interface_t* interface);
@@ -161,11 +209,36 @@ dop_oop_interface_t* dop_adapter_func_to_oop(dop_func_create_t create_func,
 dop_func_create_t dop_adapter_oop_to_func_create(dop_oop_interface_t* oop_interface);
 dop_func_update_t dop_adapter_oop_to_func_update(dop_oop_interface_t* oop_interface);
 
+// Component Identity (cold metadata; see dop_metadata.h)
+const char* dop_component_id(const dop_component_t* component);
+const char* dop_component_name(const dop_component_t* component);
+const char* dop_component_version(const dop_component_t* component);
+uint64_t dop_component_creation_timestamp(const dop_component_t* component);
+int dop_component_set_id(dop_component_t* component, const char* component_id);
+int dop_component_set_name(dop_component_t* component, const char* component_name);
+int dop_component_set_version(dop_component_t* component, const char* version);
+
+// Seqlock Write/Read Protocol
+// Writers take the component by moving the sequence from even to odd and
+// release it by making it even again; readers copy without locking and
+// retry if a write overlapped.
+void dop_component_write_lock(dop_component_t* component);
+void dop_component_write_unlock(dop_component_t* component);
+void dop_component_read_data(const dop_component_t* component, size_t offset, size_t size, void* out);
+void dop_component_read_snapshot(const dop_component_t* component, dop_component_data_t* out);
+
+// Raw read side, for readers that follow pointers out of the component:
+// begin waits out a writer, retry is true if a write overlapped the reads.
+// Every begin is followed by exactly one retry.
+uint32_t dop_component_read_begin(const dop_component_t* component);
+bool dop_component_read_retry(const dop_component_t* component, uint32_t sequence);
+
 // Governance Gates
 int dop_gate_open(dop_component_t* component);
 int dop_gate_close(dop_component_t* component);
 int dop_gate_isolate(dop_component_t* component);
 bool dop_gate_is_accessible(const dop_component_t* component);
+int dop_gate_set_bulk(dop_component_t* const* components, size_t count, dop_gate_state_t state);
 
 // Topology Management
 dop_topology_node_t* dop_topology_create_node(const char* node_id, dop_component_t* component);
@@ -180,38 +253,128 @@ int dop_manifest_validate_schema(const char* xml_path);
 
 // Time Utilities (Pure Functions)
 dop_time_data_t dop_time_get_current(void);
+dop_time_data_t dop_time_from_ms(uint64_t timestamp_ms);
 dop_time_data_t dop_time_add_duration(dop_time_data_t base, uint64_t duration_ms);
 bool dop_time_is_equal(dop_time_data_t time1, dop_time_data_t time2);
 uint64_t dop_time_diff_ms(dop_time_data_t time1, dop_time_data_t time2);
 
+// Packed Time Accessors (local time)
+dop_time_t dop_time_now(void);
+uint32_t dop_time_hours(dop_time_t time);
+uint32_t dop_time_minutes(dop_time_t time);
+uint32_t dop_time_seconds(dop_time_t time);
+uint32_t dop_time_milliseconds(dop_time_t time);
+uint32_t dop_time_second_of_day(dop_time_t time);
+uint32_t dop_time_weekday(dop_time_t time);   // 0 = Sunday
+dop_time_data_t dop_time_to_data(dop_time_t time);
+dop_time_t dop_time_from_data(dop_time_data_t data);
+// Expands many timestamps at once; sorted or clustered input is fastest
+void dop_time_decompose_batch(const dop_time_t* times, size_t count, dop_time_data_t* out);
+
 // Component-Specific Logic (Separated from Data)
 // Alarm Logic
 int dop_alarm_set_time(dop_component_t* component, dop_time_data_t alarm_time);
 int dop_alarm_arm(dop_component_t* component);
 int dop_alarm_disarm(dop_component_t* component);
 bool dop_alarm_is_triggered(const dop_component_t* component);
+int dop_alarm_trigger(dop_component_t* component);
 int dop_alarm_snooze(dop_component_t* component, uint32_t duration_ms);
 
+// Recurring Alarms
+// A recurring alarm stays armed after it triggers and moves to its next
+// occurrence on a day in repeat_days. Triggering is range-based: an alarm
+// fires when an occurrence lies in (last check, now], so a late or sparse
+// update cannot step over it.
+#define DOP_ALARM_DAY(weekday)     (1u << (weekday))   // 0 = Sunday
+#define DOP_ALARM_REPEAT_NONE      0x00u
+#define DOP_ALARM_REPEAT_DAILY     0x7Fu
+#define DOP_ALARM_REPEAT_WEEKDAYS  0x3Eu
+#define DOP_ALARM_REPEAT_WEEKENDS  0x41u
+
+int dop_alarm_set_repeat(dop_component_t* component, uint8_t repeat_days);
+
+// First occurrence of the alarm's local time of day strictly after `after`,
+// on a repeat day (any day for a one-shot alarm)
+dop_time_t dop_alarm_next_occurrence(const dop_alarm_data_t* alarm, dop_time_t after);
+bool dop_alarm_crossed(const dop_alarm_data_t* alarm, dop_time_t since, dop_time_t now);
+
+// Fires one occurrence: triggers the alarm and moves a recurring one to its
+// next occurrence. Skipped if the alarm has since moved past it, or is a
+// one-shot that already fired, so each occurrence triggers once whichever
+// of the wheel, the firing index and the update path reaches it first.
+int dop_alarm_fire(dop_component_t* component, dop_time_t occurrence);
+// Same, for an alarm the caller holds for writing
+void dop_alarm_fire_locked(dop_component_t* component, dop_time_t occurrence);
+// Moves a fired alarm's wheel and index entries on: a one-shot leaves both,
+// a recurring alarm goes to its first occurrence after `after`. Store passes
+// call this for a slot's view under the shard lock, with `alarm` read from
+// the columns.
+void dop_alarm_advance(dop_component_t* component, const dop_alarm_data_t* alarm, dop_time_t after);
+
 // Clock Logic
+// Fixed offset, -12..+14 hours
 int dop_clock_set_timezone(dop_component_t* component, int32_t offset_hours);
+// Named zone such as "Europe/Paris", or NULL for the process timezone
+int dop_clock_set_zone(dop_component_t* component, const char* zone_name);
 int dop_clock_set_format(dop_component_t* component, bool is_24_hour);
 char* dop_clock_format_time(const dop_component_t* component);
 
+// Allocation-free formatting in the clock's zone: "HH:MM:SS.mmm" or
+// "H:MM:SS.mmm AM". A buffer of DOP_CLOCK_FORMAT_SIZE always fits; returns
+// the length written, 0 on error.
+#define DOP_CLOCK_FORMAT_SIZE 16
+size_t dop_clock_format_time_into(const dop_component_t* component, char* buffer, size_t size);
+
+// Renders clocks[i] at buffer + i * stride (stride >= DOP_CLOCK_FORMAT_SIZE),
+// each NUL-terminated; non-clock entries become "". Returns clocks rendered.
+size_t dop_clock_format_batch(const dop_component_t* const* clocks, size_t count, char* buffer, size_t stride);
+
 // Stopwatch Logic
 int dop_stopwatch_start(dop_component_t* component);
 int dop_stopwatch_stop(dop_component_t* component);
 int dop_stopwatch_pause(dop_component_t* component);
 int dop_stopwatch_reset(dop_component_t* component);
 int dop_stopwatch_lap(dop_component_t* component);
+uint64_t dop_stopwatch_elapsed_ns(const dop_component_t* component);
 
 // Timer Logic
 int dop_timer_set_duration(dop_component_t* component, uint64_t duration_ms);
+int dop_timer_set_duration_ns(dop_component_t* component, uint64_t duration_ns);
 int dop_timer_start(dop_component_t* component);
 int dop_timer_stop(dop_component_t* component);
 int dop_timer_reset(dop_component_t* component);
 bool dop_timer_is_expired(const dop_component_t* component);
+uint64_t dop_timer_remaining_ns(const dop_component_t* component);
+int dop_timer_expire(dop_component_t* component);
+
+// Periodic Timers
+// With auto_restart set, an expiring timer stays running and its next
+// deadline is the previous deadline plus the period, never "now" plus the
+// period, so lateness does not accumulate. Periods that end before the
+// timer is serviced are counted in missed_periods and skipped.
+int dop_timer_set_auto_restart(dop_component_t* component, bool auto_restart);
+uint32_t dop_timer_missed_periods(const dop_component_t* component);
+uint64_t dop_timer_periods(const dop_component_t* component);
+
+// Applies expiry at now_ns to timer data the caller holds for writing.
+// A one-shot timer stops; a periodic one advances by the periods that have
+// ended. Returns false, changing nothing, for a timer that is not running
+// or whose duration has not yet elapsed.
+bool dop_timer_data_expire(dop_timer_data_t* timer, uint64_t now_ns);
+
+// Fires every due timer in one pass and reschedules the periodic ones on
+// the default wheel under a single lock. Entries that are not running
+// timers are skipped and duplicates are fired once. Returns the number of
+// timers fired.
+size_t dop_timer_expire_batch(dop_component_t* const* timers, size_t count, uint64_t now_ns);
 
 // Cryptographic Integrity
+typedef enum {
+    DOP_CHECKSUM_CRC32 = 0,   // IEEE 802.3 polynomial (legacy default)
+    DOP_CHECKSUM_CRC32C = 1,  // Castagnoli polynomial (SSE4.2 accelerated)
+    DOP_CHECKSUM_FIELDWISE = 2 // XOR of per-word contributions, incrementally updatable
+} dop_checksum_algorithm_t;
+
 uint32_t dop_checksum_calculate(const dop_component_t* component);
 bool dop_checksum_verify(const dop_component_t* component);
 int dop_component_validate_integrity(const dop_component_t* component);
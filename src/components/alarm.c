@@ -1,6 +1,70 @@
 #include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+#include "dop_checksum.h"
+#include "dop_timing_wheel.h"
+#include "dop_time.h"
+#include "dop_alarm_index.h"
+#include "dop_journal.h"
 #include <string.h>
 
+#define ALARM_MS_PER_DAY 86400000ull
+
+// Occurrences
+dop_time_t dop_alarm_next_occurrence(const dop_alarm_data_t* alarm, dop_time_t after) {
+    if (!alarm) return UINT64_MAX;
+    
+    int64_t target = dop_time_second_of_day(alarm->alarm_time);
+    int64_t target_ms = target * 1000 + (int64_t)(alarm->alarm_time % 1000);
+    uint32_t days = alarm->repeat_days & DOP_ALARM_REPEAT_DAILY;
+    int64_t midnight_ms = (int64_t)after - (int64_t)dop_time_second_of_day(after) * 1000 - (int64_t)(after % 1000);
+    
+    // Today and the next seven days cover every repeat day
+    for (int64_t day = 0; day <= 7; day++) {
+        int64_t candidate = midnight_ms + day * (int64_t)ALARM_MS_PER_DAY + target_ms;
+        if (candidate < 0) continue;
+        
+        // A day spanning a UTC offset change is not 24h long
+        int64_t drift = target - (int64_t)dop_time_second_of_day((dop_time_t)candidate);
+        if (drift > 43200) drift -= 86400;
+        if (drift < -43200) drift += 86400;
+        candidate += drift * 1000;
+        
+        if (candidate > (int64_t)after &&
+            (days == 0 || (days & DOP_ALARM_DAY(dop_time_weekday((dop_time_t)candidate))))) {
+            return (dop_time_t)candidate;
+        }
+    }
+    return after + ALARM_MS_PER_DAY;
+}
+
+bool dop_alarm_crossed(const dop_alarm_data_t* alarm, dop_time_t since, dop_time_t now) {
+    return alarm && since < now && dop_alarm_next_occurrence(alarm, since) <= now;
+}
+
+// Caller holds the write lock. Puts the alarm on the wheel and in the
+// index at a wall-clock occurrence.
+static void alarm_schedule_locked(dop_component_t* component, dop_time_t occurrence) {
+    dop_time_t now = dop_time_now();
+    uint64_t delay_ms = occurrence > now ? occurrence - now : 0;
+    dop_timing_wheel_schedule(dop_timing_wheel_default(), component, dop_time_monotonic_ms() + delay_ms);
+    dop_alarm_index_set(component, occurrence);
+}
+
+// Next occurrence from the start of the current second: an alarm set
+// earlier in this second is due immediately, one later in it fires on its
+// millisecond
+static void alarm_arm_locked(dop_component_t* component) {
+    dop_time_t now = dop_time_now();
+    dop_time_t second_start = now - now % 1000;
+    alarm_schedule_locked(component,
+                          dop_alarm_next_occurrence(&component->data.alarm, second_start ? second_start - 1 : 0));
+}
+
+static void alarm_unschedule_locked(dop_component_t* component) {
+    dop_timing_wheel_cancel(dop_timing_wheel_default(), component);
+    dop_alarm_index_remove(component);
+}
+
 int dop_alarm_set_time(dop_component_t* component, dop_time_data_t alarm_time) {
     if (!component || component->metadata.type != DOP_COMPONENT_ALARM) {
         return DOP_ERROR_INVALID_PARAMETER;
@@ -10,10 +74,15 @@ int dop_alarm_set_time(dop_component_t* component, dop_time_data_t alarm_time) {
         return DOP_ERROR_GATE_CLOSED;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
-    component->data.alarm.alarm_time = alarm_time;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(alarm.alarm_time));
+    component->data.alarm.alarm_time = dop_time_from_data(alarm_time);
+    dop_checksum_field_commit(component, before, DOP_FIELD(alarm.alarm_time));
+    dop_store_sync_view(component);
+    if (component->data.alarm.is_armed) {
+        alarm_arm_locked(component);
+    }
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -23,10 +92,16 @@ int dop_alarm_arm(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(alarm.is_armed));
+    if (!component->data.alarm.is_armed) {
+        dop_journal_record(component, DOP_JOURNAL_ARM, 0);
+    }
     component->data.alarm.is_armed = true;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD(alarm.is_armed));
+    dop_store_sync_view(component);
+    alarm_arm_locked(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -36,11 +111,112 @@ int dop_alarm_disarm(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(alarm.is_armed, alarm.is_triggered));
+    if (component->data.alarm.is_armed) {
+        dop_journal_record(component, DOP_JOURNAL_DISARM, 0);
+    }
     component->data.alarm.is_armed = false;
     component->data.alarm.is_triggered = false;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(alarm.is_armed, alarm.is_triggered));
+    dop_store_sync_view(component);
+    alarm_unschedule_locked(component);
+    dop_component_write_unlock(component);
+    
+    return DOP_SUCCESS;
+}
+
+int dop_alarm_set_repeat(dop_component_t* component, uint8_t repeat_days) {
+    if (!component || component->metadata.type != DOP_COMPONENT_ALARM ||
+        (repeat_days & ~DOP_ALARM_REPEAT_DAILY)) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(alarm.repeat_days));
+    component->data.alarm.repeat_days = repeat_days;
+    dop_checksum_field_commit(component, before, DOP_FIELD(alarm.repeat_days));
+    dop_store_sync_view(component);
+    if (component->data.alarm.is_armed) {
+        alarm_arm_locked(component);
+    }
+    dop_component_write_unlock(component);
+    
+    return DOP_SUCCESS;
+}
+
+// Triggering
+// Caller holds the write lock. A one-shot alarm triggers once and leaves the
+// schedule; a recurring one triggers on every occurrence and moves on.
+static void alarm_fire_locked(dop_component_t* component, dop_time_t occurrence) {
+    dop_alarm_data_t* alarm = &component->data.alarm;
+    if (!alarm->is_armed) {
+        alarm_unschedule_locked(component);
+        return;
+    }
+    
+    if (!alarm->is_triggered) {
+        uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(alarm.is_triggered));
+        alarm->is_triggered = true;
+        dop_checksum_field_commit(component, before, DOP_FIELD(alarm.is_triggered));
+        dop_store_sync_view(component);
+    }
+    dop_journal_record(component, DOP_JOURNAL_TRIGGER, 0);
+    
+    // Occurrences missed while not serviced are skipped, not replayed
+    dop_time_t now = dop_time_now();
+    dop_alarm_advance(component, alarm, occurrence > now ? occurrence : now);
+}
+
+void dop_alarm_advance(dop_component_t* component, const dop_alarm_data_t* alarm, dop_time_t after) {
+    if (!component || !alarm) return;
+    
+    if (alarm->repeat_days == 0) {
+        alarm_unschedule_locked(component);
+    } else {
+        alarm_schedule_locked(component, dop_alarm_next_occurrence(alarm, after));
+    }
+}
+
+// An alarm popped off the index has no pending occurrence until it fires;
+// a one-shot that already triggered has none left.
+void dop_alarm_fire_locked(dop_component_t* component, dop_time_t occurrence) {
+    dop_time_t pending = dop_alarm_index_time(component);
+    if (pending != DOP_ALARM_INDEX_NONE ? pending > occurrence :
+        component->data.alarm.is_triggered && component->data.alarm.repeat_days == 0) {
+        return;
+    }
+    alarm_fire_locked(component, occurrence);
+}
+
+int dop_alarm_fire(dop_component_t* component, dop_time_t occurrence) {
+    if (!component || component->metadata.type != DOP_COMPONENT_ALARM) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    
+    dop_component_write_lock(component);
+    dop_alarm_fire_locked(component, occurrence);
+    dop_component_write_unlock(component);
+    
+    return DOP_SUCCESS;
+}
+
+// Called by the timing wheel when the alarm (or snooze) deadline passes.
+// A batch collected before the occurrence fired elsewhere finds nothing
+// pending, or the alarm back on the wheel for a later one.
+int dop_alarm_trigger(dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_ALARM) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    
+    dop_component_write_lock(component);
+    dop_time_t occurrence = dop_alarm_index_time(component);
+    if (occurrence != DOP_ALARM_INDEX_NONE &&
+        (occurrence <= dop_time_now() ||
+         dop_timing_wheel_deadline(dop_timing_wheel_default(), component) == UINT64_MAX)) {
+        alarm_fire_locked(component, occurrence);
+    }
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -50,7 +226,9 @@ bool dop_alarm_is_triggered(const dop_component_t* component) {
         return false;
     }
     
-    return component->data.alarm.is_triggered;
+    bool is_triggered;
+    dop_component_read_data(component, DOP_FIELD(alarm.is_triggered), &is_triggered);
+    return is_triggered;
 }
 
 int dop_alarm_snooze(dop_component_t* component, uint32_t duration_ms) {
@@ -58,11 +236,17 @@ int dop_alarm_snooze(dop_component_t* component, uint32_t duration_ms) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(alarm.is_triggered, alarm.snooze_duration_ms));
     component->data.alarm.snooze_duration_ms = duration_ms;
     component->data.alarm.is_triggered = false;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(alarm.is_triggered, alarm.snooze_duration_ms));
+    dop_journal_record(component, DOP_JOURNAL_SNOOZE, duration_ms);
+    dop_store_sync_view(component);
+    if (component->data.alarm.is_armed) {
+        alarm_schedule_locked(component, dop_time_now() + duration_ms);
+    }
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -1,16 +1,47 @@
 #include "obinexus_dop_core.h"
-#include <stdio.h>
+#include "dop_component_store.h"
+#include "dop_checksum.h"
+#include "dop_tz.h"
 #include <stdlib.h>
+#include <string.h>
+
+// Caller holds the write lock
+static void clock_set_zone_locked(dop_component_t* component, uint16_t zone, int32_t offset) {
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(clock.timezone_offset, clock.timezone_id));
+    component->data.clock.timezone_id = zone;
+    component->data.clock.timezone_offset = offset;
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(clock.timezone_offset, clock.timezone_id));
+    dop_store_sync_view(component);
+}
 
 int dop_clock_set_timezone(dop_component_t* component, int32_t offset_hours) {
+    if (!component || component->metadata.type != DOP_COMPONENT_CLOCK ||
+        offset_hours < -12 || offset_hours > 14) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    
+    dop_component_write_lock(component);
+    clock_set_zone_locked(component, DOP_TZ_FIXED, offset_hours * 3600);
+    dop_component_write_unlock(component);
+    
+    return DOP_SUCCESS;
+}
+
+int dop_clock_set_zone(dop_component_t* component, const char* zone_name) {
     if (!component || component->metadata.type != DOP_COMPONENT_CLOCK) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
-    component->data.clock.timezone_offset = offset_hours;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    // Tables are compiled outside the component lock
+    uint16_t zone = DOP_TZ_LOCAL;
+    if (zone_name) {
+        int result = dop_tz_load(zone_name, &zone);
+        if (result != DOP_SUCCESS) return result;
+    }
+    
+    dop_component_write_lock(component);
+    clock_set_zone_locked(component, zone, dop_tz_offset(zone, component->data.clock.current_time));
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -20,42 +51,141 @@ int dop_clock_set_format(dop_component_t* component, bool is_24_hour) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(clock.is_24_hour_format));
     component->data.clock.is_24_hour_format = is_24_hour;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD(clock.is_24_hour_format));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
 
-char* dop_clock_format_time(const dop_component_t* component) {
-    if (!component || component->metadata.type != DOP_COMPONENT_CLOCK) {
-        return NULL;
+// "00".."99": two digits per table lookup, no division by ten per digit
+static const char clock_digit_pairs[201] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+// Per-thread H:M:S prefix of the most recently formatted local second;
+// within a second only the millisecond digits change
+typedef struct {
+    int64_t local_second;
+    bool is_valid;
+    uint8_t prefix_12_length;
+    char prefix_24[9];     // "HH:MM:SS."
+    char prefix_12[9];     // "H:MM:SS." or "HH:MM:SS."
+    char suffix_12[3];     // " AM" or " PM"
+} clock_format_cache_t;
+
+static _Thread_local clock_format_cache_t t_clock_format_cache;
+
+static inline void clock_put_pair(char* out, uint32_t value) {
+    memcpy(out, &clock_digit_pairs[value * 2], 2);
+}
+
+// The clock's offset is already resolved for current_time, so local fields
+// are plain arithmetic whatever the zone
+static const clock_format_cache_t* clock_format_prefix(dop_time_t time, int32_t offset) {
+    clock_format_cache_t* cache = &t_clock_format_cache;
+    int64_t local_second = (int64_t)(time / 1000) + offset;
+    if (cache->is_valid && cache->local_second == local_second) {
+        return cache;
     }
     
-    char* formatted_time = malloc(32);
-    if (!formatted_time) return NULL;
+    int64_t second_of_day = local_second % 86400;
+    if (second_of_day < 0) second_of_day += 86400;
+    uint32_t hours = (uint32_t)(second_of_day / 3600);
+    clock_put_pair(cache->prefix_24, hours);
+    cache->prefix_24[2] = ':';
+    clock_put_pair(cache->prefix_24 + 3, (uint32_t)(second_of_day / 60 % 60));
+    cache->prefix_24[5] = ':';
+    clock_put_pair(cache->prefix_24 + 6, (uint32_t)(second_of_day % 60));
+    cache->prefix_24[8] = '.';
+    
+    // 0 -> 12 AM, 12 -> 12 PM, 13..23 -> 1..11 PM
+    uint32_t display_hour = hours % 12 ? hours % 12 : 12;
+    uint8_t length = 0;
+    if (display_hour >= 10) {
+        cache->prefix_12[length++] = '1';
+    }
+    cache->prefix_12[length++] = (char)('0' + display_hour % 10);
+    memcpy(cache->prefix_12 + length, cache->prefix_24 + 2, 7);
+    cache->prefix_12_length = length + 7;
+    memcpy(cache->suffix_12, hours >= 12 ? " PM" : " AM", 3);
+    
+    cache->local_second = local_second;
+    cache->is_valid = true;
+    return cache;
+}
+
+// Writes at most DOP_CLOCK_FORMAT_SIZE bytes including the terminator
+static size_t clock_format(const dop_clock_data_t* clock, char* out) {
+    dop_time_t time = clock->current_time;
+    const clock_format_cache_t* cache = clock_format_prefix(time, clock->timezone_offset);
+    uint32_t milliseconds = (uint32_t)(time % 1000);
+    
+    if (clock->is_24_hour_format) {
+        memcpy(out, cache->prefix_24, 9);
+        out[9] = (char)('0' + milliseconds / 100);
+        clock_put_pair(out + 10, milliseconds % 100);
+        out[12] = '\0';
+        return 12;
+    }
+    
+    size_t length = cache->prefix_12_length;
+    memcpy(out, cache->prefix_12, length);
+    out[length] = (char)('0' + milliseconds / 100);
+    clock_put_pair(out + length + 1, milliseconds % 100);
+    memcpy(out + length + 3, cache->suffix_12, 3);
+    out[length + 6] = '\0';
+    return length + 6;
+}
+
+size_t dop_clock_format_time_into(const dop_component_t* component, char* buffer, size_t size) {
+    if (!component || component->metadata.type != DOP_COMPONENT_CLOCK || !buffer) {
+        return 0;
+    }
+    
+    // Consistent snapshot: the ticker may be rewriting current_time concurrently
+    dop_clock_data_t clock;
+    dop_component_read_data(component, DOP_FIELD(clock), &clock);
     
-    const dop_time_data_t* time = &component->data.clock.current_time;
-    
-    if (component->data.clock.is_24_hour_format) {
-        snprintf(formatted_time, 32, "%02u:%02u:%02u.%03u", 
-                time->hours, time->minutes, time->seconds, time->milliseconds);
-    } else {
-        uint32_t display_hour = time->hours;
-        const char* ampm = "AM";
-        
-        if (display_hour == 0) {
-            display_hour = 12;
-        } else if (display_hour > 12) {
-            display_hour -= 12;
-            ampm = "PM";
-        } else if (display_hour == 12) {
-            ampm = "PM";
+    if (size >= DOP_CLOCK_FORMAT_SIZE) {
+        return clock_format(&clock, buffer);
+    }
+    
+    char formatted[DOP_CLOCK_FORMAT_SIZE];
+    size_t length = clock_format(&clock, formatted);
+    if (length >= size) return 0;
+    memcpy(buffer, formatted, length + 1);
+    return length;
+}
+
+size_t dop_clock_format_batch(const dop_component_t* const* clocks, size_t count, char* buffer, size_t stride) {
+    if (!clocks || !buffer || stride < DOP_CLOCK_FORMAT_SIZE) {
+        return 0;
+    }
+    
+    size_t rendered = 0;
+    for (size_t i = 0; i < count; i++) {
+        char* out = buffer + i * stride;
+        if (dop_clock_format_time_into(clocks[i], out, stride) > 0) {
+            rendered++;
+        } else {
+            out[0] = '\0';
         }
-        
-        snprintf(formatted_time, 32, "%u:%02u:%02u.%03u %s", 
-                display_hour, time->minutes, time->seconds, time->milliseconds, ampm);
+    }
+    
+    return rendered;
+}
+
+char* dop_clock_format_time(const dop_component_t* component) {
+    char* formatted_time = malloc(DOP_CLOCK_FORMAT_SIZE);
+    if (!formatted_time) return NULL;
+    
+    if (dop_clock_format_time_into(component, formatted_time, DOP_CLOCK_FORMAT_SIZE) == 0) {
+        free(formatted_time);
+        return NULL;
     }
     
     return formatted_time;
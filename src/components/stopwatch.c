@@ -1,19 +1,43 @@
 #include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+#include "dop_checksum.h"
+#include "dop_metadata.h"
+#include "dop_laps.h"
+#include "dop_journal.h"
+#include "dop_time.h"
 #include <string.h>
+#include <stdatomic.h>
+
+// Caller holds the write lock
+static inline dop_lap_ring_t* stopwatch_lap_ring(const dop_component_t* component) {
+    dop_component_cold_t* cold = dop_metadata_cold(component->metadata.cold_index);
+    return cold ? atomic_load_explicit(&cold->lap_ring, memory_order_relaxed) : NULL;
+}
 
 int dop_stopwatch_start(dop_component_t* component) {
     if (!component || component->metadata.type != DOP_COMPONENT_STOPWATCH) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(stopwatch.start_time, stopwatch.accumulated_ns));
     if (!component->data.stopwatch.is_running) {
-        component->data.stopwatch.start_time = dop_time_get_current();
+        component->data.stopwatch.start_time = dop_time_now();
+        component->data.stopwatch.start_ns = dop_time_monotonic_ns();
+        component->data.stopwatch.accumulated_ns = 0;
         component->data.stopwatch.is_running = true;
         component->data.stopwatch.is_paused = false;
+        dop_lap_ring_restart(stopwatch_lap_ring(component));
+        dop_journal_record(component, DOP_JOURNAL_START, 0);
+    } else if (component->data.stopwatch.is_paused) {
+        // Resume: a new running segment starts now
+        component->data.stopwatch.start_ns = dop_time_monotonic_ns();
+        component->data.stopwatch.is_paused = false;
+        dop_journal_record(component, DOP_JOURNAL_RESUME, 0);
     }
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(stopwatch.start_time, stopwatch.accumulated_ns));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -23,11 +47,19 @@ int dop_stopwatch_stop(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(stopwatch.is_running, stopwatch.accumulated_ns));
+    if (component->data.stopwatch.is_running && !component->data.stopwatch.is_paused) {
+        component->data.stopwatch.accumulated_ns += dop_time_monotonic_ns() - component->data.stopwatch.start_ns;
+    }
+    if (component->data.stopwatch.is_running) {
+        dop_journal_record(component, DOP_JOURNAL_STOP, 0);
+    }
     component->data.stopwatch.is_running = false;
     component->data.stopwatch.is_paused = false;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(stopwatch.is_running, stopwatch.accumulated_ns));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -37,12 +69,16 @@ int dop_stopwatch_pause(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
-    if (component->data.stopwatch.is_running) {
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(stopwatch.is_paused, stopwatch.accumulated_ns));
+    if (component->data.stopwatch.is_running && !component->data.stopwatch.is_paused) {
+        component->data.stopwatch.accumulated_ns += dop_time_monotonic_ns() - component->data.stopwatch.start_ns;
         component->data.stopwatch.is_paused = true;
+        dop_journal_record(component, DOP_JOURNAL_PAUSE, 0);
     }
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(stopwatch.is_paused, stopwatch.accumulated_ns));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -52,14 +88,20 @@ int dop_stopwatch_reset(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(stopwatch.elapsed_ms, stopwatch.accumulated_ns));
     component->data.stopwatch.is_running = false;
     component->data.stopwatch.is_paused = false;
     component->data.stopwatch.lap_count = 0;
+    component->data.stopwatch.start_ns = 0;
+    component->data.stopwatch.accumulated_ns = 0;
     // Reset elapsed time to zero
-    memset(&component->data.stopwatch.elapsed_time, 0, sizeof(dop_time_data_t));
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    component->data.stopwatch.elapsed_ms = 0;
+    dop_lap_ring_clear(stopwatch_lap_ring(component));
+    dop_journal_record(component, DOP_JOURNAL_RESET, 0);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(stopwatch.elapsed_ms, stopwatch.accumulated_ns));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -69,12 +111,29 @@ int dop_stopwatch_lap(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(stopwatch.lap_count));
     if (component->data.stopwatch.is_running && !component->data.stopwatch.is_paused) {
         component->data.stopwatch.lap_count++;
+        dop_lap_ring_mark(stopwatch_lap_ring(component), component->data.stopwatch.accumulated_ns +
+                          (dop_time_monotonic_ns() - component->data.stopwatch.start_ns));
     }
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD(stopwatch.lap_count));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
+
+uint64_t dop_stopwatch_elapsed_ns(const dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_STOPWATCH) {
+        return 0;
+    }
+    
+    dop_stopwatch_data_t stopwatch;
+    dop_component_read_data(component, DOP_FIELD(stopwatch), &stopwatch);
+    if (!stopwatch.is_running || stopwatch.is_paused) {
+        return stopwatch.accumulated_ns;
+    }
+    return stopwatch.accumulated_ns + (dop_time_monotonic_ns() - stopwatch.start_ns);
+}
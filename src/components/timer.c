@@ -1,29 +1,67 @@
 #include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+#include "dop_checksum.h"
+#include "dop_timing_wheel.h"
+#include "dop_journal.h"
+#include "dop_time.h"
+#include <stdlib.h>
 
-int dop_timer_set_duration(dop_component_t* component, uint64_t duration_ms) {
+#define TIMER_BATCH_CHUNK 64
+
+// Wheel deadlines are whole monotonic ms; round up so expiry never precedes
+// the nanosecond deadline
+static inline uint64_t timer_deadline_ms(const dop_timer_data_t* timer) {
+    return (timer->start_ns + timer->duration_ns + DOP_NS_PER_MS - 1) / DOP_NS_PER_MS;
+}
+
+int dop_timer_set_duration_ns(dop_component_t* component, uint64_t duration_ns) {
     if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
-    component->data.timer.duration.timestamp_ms = duration_ms;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(timer.duration_ns, timer.remaining_ns));
+    component->data.timer.duration_ns = duration_ns;
+    if (!component->data.timer.is_running && !component->data.timer.is_expired) {
+        component->data.timer.remaining_ns = duration_ns;
+    }
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(timer.duration_ns, timer.remaining_ns));
+    dop_store_sync_view(component);
+    
+    // A running timer keeps its start point; only the deadline moves
+    if (component->data.timer.is_running) {
+        dop_timing_wheel_schedule(dop_timing_wheel_default(), component,
+                                  timer_deadline_ms(&component->data.timer));
+    }
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
 
+int dop_timer_set_duration(dop_component_t* component, uint64_t duration_ms) {
+    return dop_timer_set_duration_ns(component, duration_ms * DOP_NS_PER_MS);
+}
+
 int dop_timer_start(dop_component_t* component) {
     if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
-    component->data.timer.start_time = dop_time_get_current();
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(timer.start_time, timer.periods));
+    component->data.timer.start_time = dop_time_now();
+    component->data.timer.start_ns = dop_time_monotonic_ns();
+    component->data.timer.remaining_ns = component->data.timer.duration_ns;
     component->data.timer.is_running = true;
     component->data.timer.is_expired = false;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    component->data.timer.missed_periods = 0;
+    component->data.timer.periods = 0;
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(timer.start_time, timer.periods));
+    dop_journal_record(component, DOP_JOURNAL_START, 0);
+    dop_store_sync_view(component);
+    dop_timing_wheel_schedule(dop_timing_wheel_default(), component,
+                              timer_deadline_ms(&component->data.timer));
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -33,10 +71,20 @@ int dop_timer_stop(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(timer.is_running, timer.remaining_ns));
+    if (component->data.timer.is_running) {
+        // Freeze what was left so a stopped timer reports a stable value
+        uint64_t elapsed_ns = dop_time_monotonic_ns() - component->data.timer.start_ns;
+        component->data.timer.remaining_ns = elapsed_ns < component->data.timer.duration_ns ?
+                                             component->data.timer.duration_ns - elapsed_ns : 0;
+        dop_journal_record(component, DOP_JOURNAL_STOP, 0);
+    }
     component->data.timer.is_running = false;
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(timer.is_running, timer.remaining_ns));
+    dop_store_sync_view(component);
+    dop_timing_wheel_cancel(dop_timing_wheel_default(), component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
@@ -46,21 +94,187 @@ int dop_timer_reset(dop_component_t* component) {
         return DOP_ERROR_INVALID_PARAMETER;
     }
     
-    pthread_mutex_lock(&component->metadata.mutex);
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(timer.start_time, timer.periods));
     component->data.timer.is_running = false;
     component->data.timer.is_expired = false;
     // Reset to current time
-    component->data.timer.start_time = dop_time_get_current();
-    component->checksum = dop_checksum_calculate(component);
-    pthread_mutex_unlock(&component->metadata.mutex);
+    component->data.timer.start_time = dop_time_now();
+    component->data.timer.start_ns = dop_time_monotonic_ns();
+    component->data.timer.remaining_ns = component->data.timer.duration_ns;
+    component->data.timer.missed_periods = 0;
+    component->data.timer.periods = 0;
+    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(timer.start_time, timer.periods));
+    dop_journal_record(component, DOP_JOURNAL_RESET, 0);
+    dop_store_sync_view(component);
+    dop_timing_wheel_cancel(dop_timing_wheel_default(), component);
+    dop_component_write_unlock(component);
     
     return DOP_SUCCESS;
 }
 
+int dop_timer_set_auto_restart(dop_component_t* component, bool auto_restart) {
+    if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    
+    dop_component_write_lock(component);
+    uint32_t before = dop_checksum_field_begin(component, DOP_FIELD(timer.auto_restart));
+    component->data.timer.auto_restart = auto_restart;
+    dop_checksum_field_commit(component, before, DOP_FIELD(timer.auto_restart));
+    dop_store_sync_view(component);
+    dop_component_write_unlock(component);
+    
+    return DOP_SUCCESS;
+}
+
+// Expiry
+bool dop_timer_data_expire(dop_timer_data_t* timer, uint64_t now_ns) {
+    if (!timer || !timer->is_running) {
+        return false;
+    }
+    
+    // A stale wheel batch or an early dop_timer_expire() finds time left
+    uint64_t elapsed_ns = now_ns - timer->start_ns;
+    if (elapsed_ns < timer->duration_ns) {
+        return false;
+    }
+    
+    if (!timer->auto_restart || timer->duration_ns == 0) {
+        timer->is_running = false;
+        timer->is_expired = true;
+        timer->remaining_ns = 0;
+        timer->periods++;
+        return true;
+    }
+    
+    // Step whole periods from the old start so the deadline stays on its grid
+    uint64_t ended = elapsed_ns / timer->duration_ns;
+    uint64_t missed = timer->missed_periods + (ended - 1);
+    timer->start_ns += ended * timer->duration_ns;
+    timer->periods += ended;
+    timer->missed_periods = missed > UINT32_MAX ? UINT32_MAX : (uint32_t)missed;
+    timer->remaining_ns = timer->start_ns + timer->duration_ns - now_ns;
+    return true;
+}
+
+static int timer_address_compare(const void* a, const void* b) {
+    uintptr_t left = (uintptr_t)*(dop_component_t* const*)a;
+    uintptr_t right = (uintptr_t)*(dop_component_t* const*)b;
+    return (left > right) - (left < right);
+}
+
+// Component locks are taken in address order, so overlapping batches cannot
+// deadlock, and held across the wheel update to keep component-before-wheel
+// order with the setters.
+size_t dop_timer_expire_batch(dop_component_t* const* timers, size_t count, uint64_t now_ns) {
+    if (!timers) return 0;
+    
+    dop_component_t* locked[TIMER_BATCH_CHUNK];
+    dop_component_t* rearmed[TIMER_BATCH_CHUNK];
+    uint64_t deadlines_ms[TIMER_BATCH_CHUNK];
+    size_t fired = 0;
+    
+    for (size_t offset = 0; offset < count; offset += TIMER_BATCH_CHUNK) {
+        size_t chunk = count - offset < TIMER_BATCH_CHUNK ? count - offset : TIMER_BATCH_CHUNK;
+        size_t locked_count = 0;
+        size_t rearmed_count = 0;
+        
+        for (size_t i = 0; i < chunk; i++) {
+            dop_component_t* component = timers[offset + i];
+            if (component && component->metadata.type == DOP_COMPONENT_TIMER) {
+                locked[locked_count++] = component;
+            }
+        }
+        qsort(locked, locked_count, sizeof(locked[0]), timer_address_compare);
+        
+        size_t unique = 0;
+        for (size_t i = 0; i < locked_count; i++) {
+            if (unique > 0 && locked[unique - 1] == locked[i]) continue;
+            dop_component_t* component = locked[i];
+            locked[unique++] = component;
+            
+            dop_component_write_lock(component);
+            if (!component->data.timer.is_running) continue;
+            
+            uint64_t periods = component->data.timer.periods;
+            uint32_t before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(timer.is_running, timer.periods));
+            bool expired = dop_timer_data_expire(&component->data.timer, now_ns);
+            dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(timer.is_running, timer.periods));
+            if (expired) {
+                dop_journal_record(component, DOP_JOURNAL_EXPIRE,
+                                   dop_journal_periods(component->data.timer.periods - periods));
+                dop_store_sync_view(component);
+                fired++;
+            }
+            
+            // Periodic timers, and any fired early, go back on the wheel
+            if (component->data.timer.is_running) {
+                rearmed[rearmed_count] = component;
+                deadlines_ms[rearmed_count++] = timer_deadline_ms(&component->data.timer);
+            }
+        }
+        
+        dop_timing_wheel_schedule_batch(dop_timing_wheel_default(), rearmed, deadlines_ms, rearmed_count);
+        for (size_t i = 0; i < unique; i++) {
+            dop_component_write_unlock(locked[i]);
+        }
+    }
+    
+    return fired;
+}
+
+// Called by the timing wheel when the deadline passes
+int dop_timer_expire(dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    
+    dop_timer_expire_batch(&component, 1, dop_time_monotonic_ns());
+    return DOP_SUCCESS;
+}
+
 bool dop_timer_is_expired(const dop_component_t* component) {
     if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
         return false;
     }
     
-    return component->data.timer.is_expired;
+    bool is_expired;
+    dop_component_read_data(component, DOP_FIELD(timer.is_expired), &is_expired);
+    return is_expired;
+}
+
+uint64_t dop_timer_remaining_ns(const dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
+        return 0;
+    }
+    
+    dop_timer_data_t timer;
+    dop_component_read_data(component, DOP_FIELD(timer), &timer);
+    if (!timer.is_running) {
+        return timer.remaining_ns;
+    }
+    
+    uint64_t elapsed_ns = dop_time_monotonic_ns() - timer.start_ns;
+    return elapsed_ns < timer.duration_ns ? timer.duration_ns - elapsed_ns : 0;
+}
+
+uint32_t dop_timer_missed_periods(const dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
+        return 0;
+    }
+    
+    uint32_t missed_periods;
+    dop_component_read_data(component, DOP_FIELD(timer.missed_periods), &missed_periods);
+    return missed_periods;
+}
+
+uint64_t dop_timer_periods(const dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_TIMER) {
+        return 0;
+    }
+    
+    uint64_t periods;
+    dop_component_read_data(component, DOP_FIELD(timer.periods), &periods);
+    return periods;
 }
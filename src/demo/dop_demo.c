@@ -2,6 +2,10 @@
 #include "dop_adapter.h"
 #include "dop_topology.h"
 #include "dop_manifest.h"
+#include "dop_scheduler.h"
+#include "dop_wire.h"
+#include "dop_time.h"
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,9 +14,9 @@
 static void print_component_info(const dop_component_t* component) {
     if (!component) return;
     
-    printf("Component ID: %s\n", component->metadata.component_id);
-    printf("Component Name: %s\n", component->metadata.component_name);
-    printf("Version: %s\n", component->metadata.version);
+    printf("Component ID: %s\n", dop_component_id(component));
+    printf("Component Name: %s\n", dop_component_name(component));
+    printf("Version: %s\n", dop_component_version(component));
     printf("State: %d\n", component->metadata.state);
     printf("Gate State: %d\n", component->metadata.gate_state);
     printf("Checksum: 0x%08X\n", component->checksum);
@@ -195,6 +199,189 @@ static int test_xml_manifest(void) {
     return 0;
 }
 
+// Static partitioning baseline: one contiguous slice per thread and no
+// rebalancing, so the slice holding the heavy components sets the pace
+typedef struct {
+    dop_component_t* const* components;
+    size_t begin;
+    size_t end;
+    pthread_t thread;
+} bench_slice_t;
+
+static void* bench_update_slice(void* arg) {
+    bench_slice_t* slice = arg;
+    for (size_t i = slice->begin; i < slice->end; i++) {
+        dop_func_update_component(slice->components[i]);
+    }
+    return NULL;
+}
+
+static int bench_static_update(dop_component_t* const* components, size_t count, uint32_t workers) {
+    bench_slice_t* slices = calloc(workers, sizeof(bench_slice_t));
+    if (!slices) return 1;
+    
+    for (uint32_t i = 0; i < workers; i++) {
+        slices[i].components = components;
+        slices[i].begin = count * i / workers;
+        slices[i].end = count * (i + 1) / workers;
+    }
+    
+    // The calling thread takes slice 0, as the scheduler's worker 0 does
+    uint32_t started = 1;
+    while (started < workers &&
+           pthread_create(&slices[started].thread, NULL, bench_update_slice, &slices[started]) == 0) {
+        started++;
+    }
+    bench_update_slice(&slices[0]);
+    for (uint32_t i = 1; i < started; i++) {
+        pthread_join(slices[i].thread, NULL);
+    }
+    for (uint32_t i = started; i < workers; i++) {
+        bench_update_slice(&slices[i]);
+    }
+    
+    free(slices);
+    return 0;
+}
+
+// Skewed population: the heavy quarter (armed, snoozed daily alarms and
+// auto-restarting timers) sits at the front, trivial clocks fill the rest
+static size_t bench_skewed_population(dop_component_t** components, size_t count) {
+    size_t alarms = count / 8;
+    size_t timers = count / 8;
+    size_t clocks = count - alarms - timers;
+    
+    size_t created = dop_func_create_components(DOP_COMPONENT_ALARM, components, alarms);
+    created += dop_func_create_components(DOP_COMPONENT_TIMER, components + alarms, timers);
+    created += dop_func_create_components(DOP_COMPONENT_CLOCK, components + alarms + timers, clocks);
+    if (created != count) return created;
+    
+    dop_gate_set_bulk(components, count, DOP_GATE_OPEN);
+    for (size_t i = 0; i < alarms; i++) {
+        dop_alarm_set_repeat(components[i], DOP_ALARM_REPEAT_DAILY);
+        dop_alarm_arm(components[i]);
+        dop_alarm_snooze(components[i], 60000);
+    }
+    for (size_t i = alarms; i < alarms + timers; i++) {
+        dop_timer_set_duration(components[i], 1);
+        dop_timer_set_auto_restart(components[i], true);
+        dop_timer_start(components[i]);
+    }
+    return count;
+}
+
+// Update over the skewed population: static slices against work stealing
+static int bench_skewed_update(size_t count, uint32_t max_workers) {
+    dop_component_t** components = calloc(count, sizeof(dop_component_t*));
+    if (!components || bench_skewed_population(components, count) != count) {
+        printf("Failed to create %zu components\n", count);
+        if (components) dop_func_destroy_components(components, count);
+        free(components);
+        return 1;
+    }
+    
+    printf("Skewed update: %zu components, heavy quarter first, best of 5 runs\n", count);
+    printf("%8s %12s %12s %9s\n", "workers", "static ms", "stealing ms", "gain");
+    
+    int result = 0;
+    for (uint32_t workers = 1; workers <= max_workers && result == 0; workers++) {
+        dop_scheduler_t* scheduler = dop_scheduler_create(workers);
+        if (!scheduler) {
+            result = 1;
+            break;
+        }
+        
+        double best[2] = {0.0, 0.0};
+        for (int run = 0; run < 5; run++) {
+            uint64_t t0 = dop_time_monotonic_ns();
+            result |= bench_static_update(components, count, workers);
+            uint64_t t1 = dop_time_monotonic_ns();
+            result |= dop_parallel_update(scheduler, components, count, NULL);
+            uint64_t t2 = dop_time_monotonic_ns();
+            
+            double elapsed[2] = {(t1 - t0) / 1e6, (t2 - t1) / 1e6};
+            for (int mode = 0; mode < 2; mode++) {
+                if (run == 0 || elapsed[mode] < best[mode]) best[mode] = elapsed[mode];
+            }
+        }
+        
+        printf("%8u %12.3f %12.3f %8.2fx\n", workers, best[0], best[1],
+               best[1] > 0.0 ? best[0] / best[1] : 0.0);
+        dop_scheduler_destroy(scheduler);
+    }
+    
+    dop_func_destroy_components(components, count);
+    free(components);
+    return result;
+}
+
+// Times each scheduler job over `count` clocks with 1..max_workers
+// workers, then a skewed update against static partitioning; max_workers
+// 0 means one per online CPU
+static int bench_scheduler(size_t count, uint32_t max_workers) {
+    printf("=== Work-Stealing Scheduler Benchmark ===\n");
+    
+    if (max_workers == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        max_workers = online > 0 ? (uint32_t)online : 1;
+    }
+    
+    dop_component_t** clocks = malloc(count * sizeof(dop_component_t*));
+    size_t stream_size = DOP_WIRE_STREAM_SIZE(count);
+    void* stream = malloc(stream_size);
+    if (!clocks || !stream || dop_func_create_components(DOP_COMPONENT_CLOCK, clocks, count) != count) {
+        printf("Failed to create %zu components\n", count);
+        free(clocks);
+        free(stream);
+        return 1;
+    }
+    dop_gate_set_bulk(clocks, count, DOP_GATE_OPEN);
+    
+    printf("Components: %zu, best of 5 runs\n", count);
+    printf("%8s %12s %12s %12s %9s\n", "workers", "update ms", "validate ms", "serialize ms", "speedup");
+    
+    double baseline = 0.0;
+    int result = 0;
+    for (uint32_t workers = 1; workers <= max_workers; workers++) {
+        dop_scheduler_t* scheduler = dop_scheduler_create(workers);
+        if (!scheduler) {
+            result = 1;
+            break;
+        }
+        
+        double best[3] = {0.0, 0.0, 0.0};
+        for (int run = 0; run < 5; run++) {
+            uint64_t t0 = dop_time_monotonic_ns();
+            dop_parallel_update(scheduler, clocks, count, NULL);
+            uint64_t t1 = dop_time_monotonic_ns();
+            result |= dop_parallel_validate(scheduler, clocks, count, NULL);
+            uint64_t t2 = dop_time_monotonic_ns();
+            if (dop_parallel_serialize(scheduler, clocks, count, stream, stream_size) != stream_size) result = 1;
+            uint64_t t3 = dop_time_monotonic_ns();
+            
+            double elapsed[3] = {(t1 - t0) / 1e6, (t2 - t1) / 1e6, (t3 - t2) / 1e6};
+            for (int job = 0; job < 3; job++) {
+                if (run == 0 || elapsed[job] < best[job]) best[job] = elapsed[job];
+            }
+        }
+        
+        double total = best[0] + best[1] + best[2];
+        if (workers == 1) baseline = total;
+        printf("%8u %12.3f %12.3f %12.3f %8.2fx\n", workers, best[0], best[1], best[2],
+               total > 0.0 ? baseline / total : 0.0);
+        dop_scheduler_destroy(scheduler);
+    }
+    
+    dop_func_destroy_components(clocks, count);
+    free(clocks);
+    free(stream);
+    
+    printf("\n");
+    if (result == 0) result = bench_skewed_update(count, max_workers);
+    printf("Scheduler benchmark %s\n\n", result == 0 ? "completed" : "failed");
+    return result;
+}
+
 int main(int argc, char* argv[]) {
     printf("OBINexus DOP Component System Demo\n");
     printf("==================================\n\n");
@@ -208,6 +395,10 @@ int main(int argc, char* argv[]) {
             return dop_manifest_validate_schema("examples/time_components_manifest.xml");
         } else if (strcmp(argv[1], "--test-p2p-topology") == 0) {
             return test_p2p_topology();
+        } else if (strcmp(argv[1], "--bench-scheduler") == 0) {
+            size_t count = argc > 2 ? strtoul(argv[2], NULL, 10) : 100000;
+            uint32_t max_workers = argc > 3 ? (uint32_t)strtoul(argv[3], NULL, 10) : 0;
+            return bench_scheduler(count, max_workers);
         }
     }
     
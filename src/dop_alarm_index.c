@@ -0,0 +1,168 @@
+// src/dop_alarm_index.c
+// OBINexus DOP Alarm Index Implementation
+// Process-wide min-heap of armed alarms keyed by next occurrence
+
+#include "dop_alarm_index.h"
+#include "dop_metadata.h"
+#include <stdlib.h>
+
+#define ALARM_INDEX_INITIAL_CAPACITY 64u
+#define ALARM_NOT_INDEXED            UINT32_MAX
+
+typedef struct {
+    dop_time_t fire_time;
+    dop_component_t* component;
+} dop_alarm_slot_t;
+
+static pthread_mutex_t g_alarm_mutex = PTHREAD_MUTEX_INITIALIZER;
+static dop_alarm_slot_t* g_alarm_heap = NULL;
+static size_t g_alarm_count = 0;
+static size_t g_alarm_capacity = 0;
+
+// Heap (callers hold g_alarm_mutex)
+static inline dop_component_cold_t* alarm_cold(const dop_component_t* component) {
+    return dop_metadata_cold(component->metadata.cold_index);
+}
+
+static inline void alarm_heap_put(size_t position, dop_alarm_slot_t slot) {
+    g_alarm_heap[position] = slot;
+    alarm_cold(slot.component)->alarm_position = (uint32_t)position;
+}
+
+static void alarm_sift_up(size_t position) {
+    dop_alarm_slot_t slot = g_alarm_heap[position];
+
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (g_alarm_heap[parent].fire_time <= slot.fire_time) break;
+        alarm_heap_put(position, g_alarm_heap[parent]);
+        position = parent;
+    }
+    alarm_heap_put(position, slot);
+}
+
+static void alarm_sift_down(size_t position) {
+    dop_alarm_slot_t slot = g_alarm_heap[position];
+
+    for (;;) {
+        size_t child = position * 2 + 1;
+        if (child >= g_alarm_count) break;
+        if (child + 1 < g_alarm_count && g_alarm_heap[child + 1].fire_time < g_alarm_heap[child].fire_time) {
+            child++;
+        }
+        if (slot.fire_time <= g_alarm_heap[child].fire_time) break;
+        alarm_heap_put(position, g_alarm_heap[child]);
+        position = child;
+    }
+    alarm_heap_put(position, slot);
+}
+
+static void alarm_heap_remove(size_t position) {
+    alarm_cold(g_alarm_heap[position].component)->alarm_position = ALARM_NOT_INDEXED;
+
+    dop_alarm_slot_t last = g_alarm_heap[--g_alarm_count];
+    if (position == g_alarm_count) return;
+
+    alarm_heap_put(position, last);
+    alarm_sift_up(position);
+    alarm_sift_down(alarm_cold(last.component)->alarm_position);
+}
+
+// Index Maintenance
+void dop_alarm_index_set(dop_component_t* component, dop_time_t fire_time) {
+    dop_component_cold_t* cold = component ? alarm_cold(component) : NULL;
+    if (!cold) return;
+
+    pthread_mutex_lock(&g_alarm_mutex);
+    uint32_t position = cold->alarm_position;
+    if (position != ALARM_NOT_INDEXED) {
+        dop_time_t previous = g_alarm_heap[position].fire_time;
+        g_alarm_heap[position].fire_time = fire_time;
+        if (fire_time < previous) {
+            alarm_sift_up(position);
+        } else {
+            alarm_sift_down(position);
+        }
+    } else {
+        if (g_alarm_count == g_alarm_capacity) {
+            size_t capacity = g_alarm_capacity ? g_alarm_capacity * 2 : ALARM_INDEX_INITIAL_CAPACITY;
+            dop_alarm_slot_t* heap = realloc(g_alarm_heap, capacity * sizeof(dop_alarm_slot_t));
+            if (!heap) {
+                // Unindexed alarms still fire from the timing wheel
+                pthread_mutex_unlock(&g_alarm_mutex);
+                return;
+            }
+            g_alarm_heap = heap;
+            g_alarm_capacity = capacity;
+        }
+        g_alarm_heap[g_alarm_count] = (dop_alarm_slot_t){ .fire_time = fire_time, .component = component };
+        alarm_sift_up(g_alarm_count++);
+    }
+    pthread_mutex_unlock(&g_alarm_mutex);
+}
+
+void dop_alarm_index_remove(dop_component_t* component) {
+    dop_component_cold_t* cold = component ? alarm_cold(component) : NULL;
+    if (!cold) return;
+
+    pthread_mutex_lock(&g_alarm_mutex);
+    if (cold->alarm_position != ALARM_NOT_INDEXED) {
+        alarm_heap_remove(cold->alarm_position);
+    }
+    pthread_mutex_unlock(&g_alarm_mutex);
+}
+
+dop_time_t dop_alarm_index_time(const dop_component_t* component) {
+    dop_component_cold_t* cold = component ? alarm_cold(component) : NULL;
+    if (!cold) return DOP_ALARM_INDEX_NONE;
+
+    pthread_mutex_lock(&g_alarm_mutex);
+    uint32_t position = cold->alarm_position;
+    dop_time_t fire_time = position != ALARM_NOT_INDEXED ? g_alarm_heap[position].fire_time : DOP_ALARM_INDEX_NONE;
+    pthread_mutex_unlock(&g_alarm_mutex);
+    return fire_time;
+}
+
+// Queries
+dop_component_t* dop_alarm_index_next(dop_time_t* fire_time) {
+    pthread_mutex_lock(&g_alarm_mutex);
+    dop_component_t* component = g_alarm_count ? g_alarm_heap[0].component : NULL;
+    if (fire_time) *fire_time = g_alarm_count ? g_alarm_heap[0].fire_time : DOP_ALARM_INDEX_NONE;
+    pthread_mutex_unlock(&g_alarm_mutex);
+    return component;
+}
+
+size_t dop_alarm_index_count(void) {
+    pthread_mutex_lock(&g_alarm_mutex);
+    size_t count = g_alarm_count;
+    pthread_mutex_unlock(&g_alarm_mutex);
+    return count;
+}
+
+// Dispatch
+size_t dop_alarm_index_fire_due(dop_time_t now, dop_alarm_fire_t fire, void* context) {
+    dop_alarm_slot_t due[64];
+    size_t fired = 0;
+
+    // Pop in chunks and fire outside the index lock; alarms lock the
+    // component before the index. A recurring alarm re-enters the heap
+    // after its occurrence, so the loop cannot revisit it.
+    for (;;) {
+        size_t due_count = 0;
+        pthread_mutex_lock(&g_alarm_mutex);
+        while (g_alarm_count && due_count < sizeof(due) / sizeof(due[0]) && g_alarm_heap[0].fire_time <= now) {
+            due[due_count++] = g_alarm_heap[0];
+            alarm_heap_remove(0);
+        }
+        pthread_mutex_unlock(&g_alarm_mutex);
+        if (due_count == 0) break;
+
+        for (size_t i = 0; i < due_count; i++) {
+            dop_alarm_fire(due[i].component, due[i].fire_time);
+            if (fire) fire(due[i].component, context);
+        }
+        fired += due_count;
+    }
+
+    return fired;
+}
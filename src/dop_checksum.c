@@ -0,0 +1,303 @@
+// src/dop_checksum.c
+// OBINexus DOP Checksum Implementation
+// Table-driven and hardware-accelerated CRC32 / CRC32C with runtime dispatch
+
+#include "dop_checksum.h"
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DOP_CHECKSUM_X86 1
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#include <smmintrin.h>
+#endif
+
+#define DOP_CRC32_POLY  0xEDB88320u
+#define DOP_CRC32C_POLY 0x82F63B78u
+
+typedef uint32_t (*dop_crc_fn_t)(uint32_t crc, const uint8_t* data, size_t size);
+
+// Slice-by-8 tables, one set per polynomial
+static uint32_t g_crc32_table[8][256];
+static uint32_t g_crc32c_table[8][256];
+
+static dop_crc_fn_t g_crc32_fn;
+static dop_crc_fn_t g_crc32c_fn;
+static const char* g_crc32_backend = "slice-by-8";
+static const char* g_crc32c_backend = "slice-by-8";
+static pthread_once_t g_checksum_once = PTHREAD_ONCE_INIT;
+
+static void checksum_build_table(uint32_t table[8][256], uint32_t poly) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+        }
+        table[0][i] = crc;
+    }
+    for (uint32_t i = 0; i < 256; i++) {
+        for (int k = 1; k < 8; k++) {
+            table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF];
+        }
+    }
+}
+
+static inline uint32_t checksum_slice8(uint32_t table[8][256], uint32_t crc,
+                                       const uint8_t* data, size_t size) {
+    while (size >= 8) {
+        uint32_t lo, hi;
+        memcpy(&lo, data, 4);
+        memcpy(&hi, data + 4, 4);
+        lo ^= crc;
+        crc = table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF] ^
+              table[5][(lo >> 16) & 0xFF] ^ table[4][lo >> 24] ^
+              table[3][hi & 0xFF] ^ table[2][(hi >> 8) & 0xFF] ^
+              table[1][(hi >> 16) & 0xFF] ^ table[0][hi >> 24];
+        data += 8;
+        size -= 8;
+    }
+    while (size--) {
+        crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xFF];
+    }
+    return crc;
+}
+
+static uint32_t crc32_slice8(uint32_t crc, const uint8_t* data, size_t size) {
+    return checksum_slice8(g_crc32_table, crc, data, size);
+}
+
+static uint32_t crc32c_slice8(uint32_t crc, const uint8_t* data, size_t size) {
+    return checksum_slice8(g_crc32c_table, crc, data, size);
+}
+
+#ifdef DOP_CHECKSUM_X86
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_sse42(uint32_t crc, const uint8_t* data, size_t size) {
+#if defined(__x86_64__)
+    uint64_t crc64 = crc;
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        crc64 = _mm_crc32_u64(crc64, word);
+        data += 8;
+        size -= 8;
+    }
+    crc = (uint32_t)crc64;
+#endif
+    while (size >= 4) {
+        uint32_t word;
+        memcpy(&word, data, 4);
+        crc = _mm_crc32_u32(crc, word);
+        data += 4;
+        size -= 4;
+    }
+    while (size--) {
+        crc = _mm_crc32_u8(crc, *data++);
+    }
+    return crc;
+}
+
+// CRC32 by carry-less multiplication folding (Gopal et al., "Fast CRC
+// Computation for Generic Polynomials Using PCLMULQDQ"), bit-reflected
+// constants for the IEEE polynomial. Folds 64-byte blocks, then 16-byte
+// blocks, and finishes the tail with the table.
+__attribute__((target("sse4.1,pclmul")))
+static uint32_t crc32_pclmul(uint32_t crc, const uint8_t* data, size_t size) {
+    if (size < 64) {
+        return crc32_slice8(crc, data, size);
+    }
+
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128((const __m128i*)(data + 0x00));
+    __m128i x2 = _mm_loadu_si128((const __m128i*)(data + 0x10));
+    __m128i x3 = _mm_loadu_si128((const __m128i*)(data + 0x20));
+    __m128i x4 = _mm_loadu_si128((const __m128i*)(data + 0x30));
+    __m128i x0, x5, x6, x7, x8;
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    data += 64;
+    size -= 64;
+
+    // Fold four lanes in parallel
+    while (size >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(data + 0x30)));
+
+        data += 64;
+        size -= 64;
+    }
+
+    // Fold the four lanes into one
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    while (size >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i*)data)), x5);
+        data += 16;
+        size -= 16;
+    }
+
+    // Fold 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x0 = k5k0;
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    crc = (uint32_t)_mm_extract_epi32(x1, 1);
+    return crc32_slice8(crc, data, size);
+}
+#endif // DOP_CHECKSUM_X86
+
+static void checksum_init(void) {
+    checksum_build_table(g_crc32_table, DOP_CRC32_POLY);
+    checksum_build_table(g_crc32c_table, DOP_CRC32C_POLY);
+
+    g_crc32_fn = crc32_slice8;
+    g_crc32c_fn = crc32c_slice8;
+
+#ifdef DOP_CHECKSUM_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        g_crc32c_fn = crc32c_sse42;
+        g_crc32c_backend = "sse4.2";
+    }
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+        g_crc32_fn = crc32_pclmul;
+        g_crc32_backend = "pclmul";
+    }
+#endif
+}
+
+// Fieldwise checksum: keyed fmix64 of each 8-byte word, folded to 32 bits.
+// fmix64 is a bijection, so changing any single word always changes its term.
+static inline uint32_t checksum_mix_word(uint64_t index, uint64_t word) {
+    uint64_t x = word ^ ((index + 1) * 0x9E3779B97F4A7C15ull);
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return (uint32_t)(x ^ (x >> 32));
+}
+
+static uint32_t checksum_fieldwise(const uint8_t* data, size_t first_word, size_t last_word, size_t size) {
+    uint32_t checksum = 0;
+    for (size_t i = first_word; i < last_word; i++) {
+        uint64_t word = 0;
+        size_t offset = i * 8;
+        memcpy(&word, data + offset, size - offset < 8 ? size - offset : 8);
+        checksum ^= checksum_mix_word(i, word);
+    }
+    return checksum;
+}
+
+uint32_t dop_checksum_compute(dop_checksum_algorithm_t algorithm, const void* data, size_t size) {
+    if (algorithm == DOP_CHECKSUM_FIELDWISE) {
+        return checksum_fieldwise((const uint8_t*)data, 0, (size + 7) / 8, size);
+    }
+
+    pthread_once(&g_checksum_once, checksum_init);
+
+    dop_crc_fn_t fn = algorithm == DOP_CHECKSUM_CRC32C ? g_crc32c_fn : g_crc32_fn;
+    return ~fn(0xFFFFFFFFu, (const uint8_t*)data, size);
+}
+
+uint32_t dop_checksum_compute_portable(dop_checksum_algorithm_t algorithm, const void* data, size_t size) {
+    if (algorithm == DOP_CHECKSUM_FIELDWISE) {
+        return dop_checksum_compute(algorithm, data, size);
+    }
+
+    pthread_once(&g_checksum_once, checksum_init);
+
+    dop_crc_fn_t fn = algorithm == DOP_CHECKSUM_CRC32C ? crc32c_slice8 : crc32_slice8;
+    return ~fn(0xFFFFFFFFu, (const uint8_t*)data, size);
+}
+
+const char* dop_checksum_backend_name(dop_checksum_algorithm_t algorithm) {
+    pthread_once(&g_checksum_once, checksum_init);
+    return algorithm == DOP_CHECKSUM_CRC32C ? g_crc32c_backend : g_crc32_backend;
+}
+
+// Incremental Field Checksums
+uint32_t dop_checksum_range(const dop_component_t* component, size_t offset, size_t size) {
+    if (!component || size == 0 || offset >= sizeof(dop_component_data_t)) return 0;
+
+    size_t end = offset + size;
+    if (end > sizeof(dop_component_data_t)) end = sizeof(dop_component_data_t);
+
+    return checksum_fieldwise((const uint8_t*)&component->data, offset / 8, (end + 7) / 8,
+                              sizeof(dop_component_data_t));
+}
+
+uint32_t dop_checksum_field_begin(const dop_component_t* component, size_t offset, size_t size) {
+    if (!component || component->checksum_algorithm != DOP_CHECKSUM_FIELDWISE) return 0;
+    return dop_checksum_range(component, offset, size);
+}
+
+void dop_checksum_field_commit(dop_component_t* component, uint32_t before, size_t offset, size_t size) {
+    if (!component) return;
+
+    if (component->checksum_algorithm == DOP_CHECKSUM_FIELDWISE) {
+        component->checksum ^= before ^ dop_checksum_range(component, offset, size);
+    } else {
+        component->checksum = dop_checksum_calculate(component);
+    }
+}
+
+// Cryptographic Integrity Implementation
+uint32_t dop_checksum_calculate(const dop_component_t* component) {
+    if (!component) return 0;
+
+    return dop_checksum_compute((dop_checksum_algorithm_t)component->checksum_algorithm,
+                                &component->data, sizeof(dop_component_data_t));
+}
+
+bool dop_checksum_verify(const dop_component_t* component) {
+    if (!component) return false;
+    return component->checksum == dop_checksum_calculate(component);
+}
+
+int dop_component_validate_integrity(const dop_component_t* component) {
+    if (!component) return DOP_ERROR_INVALID_PARAMETER;
+    if (component->metadata.type >= DOP_COMPONENT_COUNT) return DOP_ERROR_INVALID_STATE;
+    return dop_checksum_verify(component) ? DOP_SUCCESS : DOP_ERROR_CHECKSUM_FAILED;
+}
@@ -0,0 +1,473 @@
+// src/dop_component.c
+// OBINexus DOP Component Core Implementation
+// Functional component interface and governance gates
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+#include "dop_metadata.h"
+#include "dop_checksum.h"
+#include "dop_timing_wheel.h"
+#include "dop_alarm_index.h"
+#include "dop_tz.h"
+#include "dop_journal.h"
+#include "dop_time.h"
+#include "dop_slab.h"
+#include "dop_registry.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <sched.h>
+
+#define WRITE_LOCK_SPINS 64
+
+// Seqlock readers copy while a writer may be storing and discard torn
+// copies, a race ThreadSanitizer cannot tell from a real one. Reads between
+// read_begin and read_retry are hidden from it.
+#if defined(__SANITIZE_THREAD__)
+#define DOP_SANITIZE_THREAD 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define DOP_SANITIZE_THREAD 1
+#endif
+#endif
+
+#ifdef DOP_SANITIZE_THREAD
+void AnnotateIgnoreReadsBegin(const char* file, int line);
+void AnnotateIgnoreReadsEnd(const char* file, int line);
+#define SEQLOCK_READS_BEGIN() AnnotateIgnoreReadsBegin(__FILE__, __LINE__)
+#define SEQLOCK_READS_END()   AnnotateIgnoreReadsEnd(__FILE__, __LINE__)
+#else
+#define SEQLOCK_READS_BEGIN() ((void)0)
+#define SEQLOCK_READS_END()   ((void)0)
+#endif
+
+// Data-Oriented Implementation: Pure Functions Operating on Data
+
+// Functional Programming Interface Implementation
+// A bulk-create template is never registered; each copy gets its own ID
+static int component_init(dop_component_t* component, dop_component_type_t type, bool register_id) {
+    if (!component) return DOP_ERROR_INVALID_PARAMETER;
+
+    const char* component_name;
+    switch (type) {
+        case DOP_COMPONENT_ALARM:
+            component_name = "Alarm Component";
+            break;
+        case DOP_COMPONENT_CLOCK:
+            component_name = "Clock Component";
+            break;
+        case DOP_COMPONENT_STOPWATCH:
+            component_name = "Stopwatch Component";
+            break;
+        case DOP_COMPONENT_TIMER:
+            component_name = "Timer Component";
+            break;
+        default:
+            return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    memset(component, 0, sizeof(dop_component_t));
+
+    // Cold metadata lives in the side table
+    component->metadata.cold_index = dop_metadata_acquire();
+    dop_component_cold_t* cold = dop_metadata_cold(component->metadata.cold_index);
+    if (!cold) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    // Generated IDs encode the type
+    component->metadata.type = type;
+    if (dop_component_set_name(component, component_name) != DOP_SUCCESS ||
+        dop_component_set_version(component, "1.0.0") != DOP_SUCCESS ||
+        (register_id && dop_registry_assign(component) != DOP_SUCCESS)) {
+        dop_metadata_release(component->metadata.cold_index);
+        return DOP_ERROR_MEMORY_ALLOCATION;
+    }
+    cold->creation_timestamp = (uint64_t)time(NULL) * 1000;
+
+    // Hot metadata
+    component->metadata.state = DOP_STATE_READY;
+    atomic_init(&component->metadata.gate_state, DOP_GATE_CLOSED);
+    component->metadata.last_update_timestamp = cold->creation_timestamp;
+    component->store = NULL;
+    component->handle = DOP_HANDLE_INVALID;
+    component->checksum_algorithm = DOP_CHECKSUM_FIELDWISE;
+    component->wheel_entry.bucket = DOP_WHEEL_UNSCHEDULED;
+    component->wheel_entry.pins = 0;
+    atomic_init(&component->sequence, 0);
+
+    // Initialize component-specific data
+    switch (type) {
+        case DOP_COMPONENT_CLOCK:
+            component->data.clock.current_time = dop_time_now();
+            component->data.clock.is_running = true;
+            component->data.clock.timezone_id = DOP_TZ_LOCAL;
+            component->data.clock.timezone_offset = dop_time_utc_offset(component->data.clock.current_time);
+            component->data.clock.is_24_hour_format = true;
+            break;
+        case DOP_COMPONENT_ALARM:
+            component->data.alarm.current_time = dop_time_now();
+            component->data.alarm.is_armed = false;
+            component->data.alarm.is_triggered = false;
+            component->data.alarm.snooze_duration_ms = 300000; // 5 minutes
+            break;
+        case DOP_COMPONENT_STOPWATCH:
+            component->data.stopwatch.is_running = false;
+            component->data.stopwatch.is_paused = false;
+            component->data.stopwatch.lap_count = 0;
+            break;
+        case DOP_COMPONENT_TIMER:
+            component->data.timer.is_running = false;
+            component->data.timer.is_expired = false;
+            component->data.timer.auto_restart = false;
+            break;
+        default:
+            break;
+    }
+
+    component->checksum = dop_checksum_calculate(component);
+    return DOP_SUCCESS;
+}
+
+int dop_component_init(dop_component_t* component, dop_component_type_t type) {
+    return component_init(component, type, true);
+}
+
+dop_component_t* dop_func_create_component(dop_component_type_t type) {
+    dop_component_t* component = dop_slab_alloc(type);
+    if (!component) return NULL;
+
+    if (dop_component_init(component, type) != DOP_SUCCESS) {
+        component->metadata.type = type;
+        dop_slab_free(component);
+        return NULL;
+    }
+
+    return component;
+}
+
+// Bulk creation initializes one template and stamps it into every object;
+// slab objects and cold slots are each taken in a single batch
+size_t dop_func_create_components(dop_component_type_t type, dop_component_t** components, size_t count) {
+    if (!components || count == 0) return 0;
+
+    dop_component_t template_component;
+    if (component_init(&template_component, type, false) != DOP_SUCCESS) return 0;
+
+    size_t allocated = dop_slab_alloc_batch(type, components, count);
+    for (size_t i = 0; i < allocated; i++) {
+        memcpy(components[i], &template_component, sizeof(dop_component_t));
+    }
+
+    size_t cloned = dop_metadata_clone(template_component.metadata.cold_index, components, allocated);
+    dop_metadata_release(template_component.metadata.cold_index);
+
+    // Each copy still needs its own ID
+    size_t created = dop_registry_assign_batch(components, cloned);
+    if (created < cloned) {
+        dop_metadata_release_batch(components + created, cloned - created);
+    }
+    if (created < allocated) {
+        dop_slab_free_batch(components + created, allocated - created);
+    }
+    for (size_t i = created; i < count; i++) {
+        components[i] = NULL;
+    }
+
+    return created;
+}
+
+int dop_func_update_component(dop_component_t* component) {
+    if (!component || !dop_gate_is_accessible(component)) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    dop_component_write_lock(component);
+
+    dop_time_t current_time = dop_time_now();
+    uint32_t before;
+
+    switch (component->metadata.type) {
+        case DOP_COMPONENT_CLOCK:
+            before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(clock.current_time, clock.timezone_offset));
+            component->data.clock.current_time = current_time;
+            if (component->data.clock.timezone_id != DOP_TZ_FIXED) {
+                component->data.clock.timezone_offset = dop_tz_offset(component->data.clock.timezone_id, current_time);
+            }
+            dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(clock.current_time, clock.timezone_offset));
+            break;
+
+        case DOP_COMPONENT_ALARM: {
+            dop_time_t since = component->data.alarm.current_time;
+            before = dop_checksum_field_begin(component, DOP_FIELD(alarm.current_time));
+            component->data.alarm.current_time = current_time;
+            dop_checksum_field_commit(component, before, DOP_FIELD(alarm.current_time));
+
+            // An occurrence or snooze that came due since the previous update
+            // fires here and moves the schedule on, so the wheel does not
+            // fire it again
+            if (component->data.alarm.is_armed &&
+                (!component->data.alarm.is_triggered || component->data.alarm.repeat_days)) {
+                dop_time_t due = dop_alarm_crossed(&component->data.alarm, since, current_time) ?
+                                 dop_alarm_next_occurrence(&component->data.alarm, since) :
+                                 dop_alarm_index_time(component);
+                if (due <= current_time) dop_alarm_fire_locked(component, due);
+            }
+            break;
+        }
+
+        case DOP_COMPONENT_STOPWATCH:
+            if (component->data.stopwatch.is_running && !component->data.stopwatch.is_paused) {
+                // Elapsed comes from the monotonic base; wall time is display only
+                uint64_t elapsed_ns = component->data.stopwatch.accumulated_ns +
+                                      (dop_time_monotonic_ns() - component->data.stopwatch.start_ns);
+                before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(stopwatch.current_time, stopwatch.elapsed_ms));
+                component->data.stopwatch.current_time = current_time;
+                component->data.stopwatch.elapsed_ms = elapsed_ns / DOP_NS_PER_MS;
+                dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(stopwatch.current_time, stopwatch.elapsed_ms));
+            }
+            break;
+
+        case DOP_COMPONENT_TIMER:
+            if (component->data.timer.is_running) {
+                uint64_t now_ns = dop_time_monotonic_ns();
+                if (now_ns - component->data.timer.start_ns >= component->data.timer.duration_ns) {
+                    uint64_t periods = component->data.timer.periods;
+                    before = dop_checksum_field_begin(component, DOP_FIELD_SPAN(timer.is_running, timer.periods));
+                    dop_timer_data_expire(&component->data.timer, now_ns);
+                    dop_checksum_field_commit(component, before, DOP_FIELD_SPAN(timer.is_running, timer.periods));
+                    dop_journal_record(component, DOP_JOURNAL_EXPIRE, dop_journal_periods(component->data.timer.periods - periods));
+                    // A periodic timer moved to its next deadline
+                    if (component->data.timer.is_running) {
+                        uint64_t deadline_ns = component->data.timer.start_ns + component->data.timer.duration_ns;
+                        dop_timing_wheel_schedule(dop_timing_wheel_default(), component,
+                                                  (deadline_ns + DOP_NS_PER_MS - 1) / DOP_NS_PER_MS);
+                    }
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    component->metadata.last_update_timestamp = current_time;
+    dop_store_sync_view(component);
+
+    dop_component_write_unlock(component);
+    return DOP_SUCCESS;
+}
+
+int dop_func_destroy_component(dop_component_t* component) {
+    if (!component) return DOP_ERROR_INVALID_PARAMETER;
+
+    // Store-backed views are owned by their store
+    if (component->store) {
+        return dop_store_remove(component->store, component->handle);
+    }
+
+    dop_timing_wheel_release(dop_timing_wheel_default(), component);
+    if (component->metadata.type == DOP_COMPONENT_ALARM) {
+        dop_alarm_index_remove(component);
+    }
+
+    component->metadata.state = DOP_STATE_DESTROYED;
+    dop_registry_remove(component);
+    dop_metadata_release(component->metadata.cold_index);
+    dop_slab_free(component);
+    return DOP_SUCCESS;
+}
+
+void dop_func_destroy_components(dop_component_t* const* components, size_t count) {
+    if (!components) return;
+
+    // Standalone components are released in chunks to share lock round trips
+    dop_component_t* pending[DOP_SLAB_BATCH];
+    size_t pending_count = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        dop_component_t* component = components[i];
+        if (!component) continue;
+
+        if (component->store) {
+            dop_store_remove(component->store, component->handle);
+            continue;
+        }
+
+        if (component->metadata.type == DOP_COMPONENT_ALARM) {
+            dop_alarm_index_remove(component);
+        }
+        component->metadata.state = DOP_STATE_DESTROYED;
+        pending[pending_count++] = component;
+
+        if (pending_count == DOP_SLAB_BATCH) {
+            dop_timing_wheel_release_batch(dop_timing_wheel_default(), pending, pending_count);
+            dop_registry_remove_batch(pending, pending_count);
+            dop_metadata_release_batch(pending, pending_count);
+            dop_slab_free_batch(pending, pending_count);
+            pending_count = 0;
+        }
+    }
+
+    if (pending_count > 0) {
+        dop_timing_wheel_release_batch(dop_timing_wheel_default(), pending, pending_count);
+        dop_registry_remove_batch(pending, pending_count);
+        dop_metadata_release_batch(pending, pending_count);
+        dop_slab_free_batch(pending, pending_count);
+    }
+}
+
+char* dop_func_serialize_component(const dop_component_t* component) {
+    if (!component) return NULL;
+
+    char* serialized = malloc(512);
+    if (!serialized) return NULL;
+
+    snprintf(serialized, 512,
+             "{\"id\":\"%s\",\"name\":\"%s\",\"version\":\"%s\","
+             "\"type\":%d,\"state\":%d,\"gate\":%d,\"checksum\":%u}",
+             dop_component_id(component),
+             dop_component_name(component),
+             dop_component_version(component),
+             component->metadata.type,
+             component->metadata.state,
+             (int)atomic_load_explicit(&component->metadata.gate_state, memory_order_acquire),
+             component->checksum);
+
+    return serialized;
+}
+
+// Seqlock Implementation
+void dop_component_write_lock(dop_component_t* component) {
+    // The odd sequence is the writer lock; no separate mutex in the hot block
+    for (uint32_t spins = 0;; spins++) {
+        uint32_t sequence = atomic_load_explicit(&component->sequence, memory_order_relaxed);
+        if (!(sequence & 1) &&
+            atomic_compare_exchange_weak_explicit(&component->sequence, &sequence, sequence + 1,
+                                                  memory_order_acquire, memory_order_relaxed)) {
+            break;
+        }
+        if (spins >= WRITE_LOCK_SPINS) {
+            sched_yield();
+            spins = 0;
+        }
+    }
+    atomic_thread_fence(memory_order_release);
+
+    // Store views pick up what bulk passes wrote before a setter writes back
+    if (component->store) dop_store_refresh_view(component);
+}
+
+void dop_component_write_unlock(dop_component_t* component) {
+    uint32_t sequence = atomic_load_explicit(&component->sequence, memory_order_relaxed);
+    atomic_store_explicit(&component->sequence, sequence + 1, memory_order_release);
+}
+
+uint32_t dop_component_read_begin(const dop_component_t* component) {
+    uint32_t sequence;
+    // Writer active: spin briefly, then give a preempted writer the CPU
+    for (uint32_t spins = 0;
+         (sequence = atomic_load_explicit(&component->sequence, memory_order_acquire)) & 1; spins++) {
+        if (spins >= WRITE_LOCK_SPINS) {
+            sched_yield();
+            spins = 0;
+        }
+    }
+    SEQLOCK_READS_BEGIN();
+    return sequence;
+}
+
+bool dop_component_read_retry(const dop_component_t* component, uint32_t sequence) {
+    SEQLOCK_READS_END();
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&component->sequence, memory_order_relaxed) != sequence;
+}
+
+void dop_component_read_data(const dop_component_t* component, size_t offset, size_t size, void* out) {
+    const uint8_t* data = (const uint8_t*)&component->data + offset;
+
+    uint32_t sequence;
+    do {
+        sequence = dop_component_read_begin(component);
+        memcpy(out, data, size);
+    } while (dop_component_read_retry(component, sequence));
+}
+
+void dop_component_read_snapshot(const dop_component_t* component, dop_component_data_t* out) {
+    dop_component_read_data(component, 0, sizeof(dop_component_data_t), out);
+}
+
+// Governance Gate Implementation
+// The gate is a single atomic word: transitions are release writes and
+// dop_gate_is_accessible() is one acquire load, so the hot-path check never
+// touches the component mutex. Only actual flips are journaled.
+static int gate_transition(dop_component_t* component, dop_gate_state_t state) {
+    if (!component) return DOP_ERROR_INVALID_PARAMETER;
+
+    dop_gate_state_t previous = atomic_exchange_explicit(&component->metadata.gate_state, state, memory_order_release);
+    if (previous != state) {
+        dop_journal_record(component, DOP_JOURNAL_GATE, (uint32_t)state);
+    }
+    return dop_store_sync_gate(component, state);
+}
+
+int dop_gate_open(dop_component_t* component) {
+    return gate_transition(component, DOP_GATE_OPEN);
+}
+
+int dop_gate_close(dop_component_t* component) {
+    return gate_transition(component, DOP_GATE_CLOSED);
+}
+
+int dop_gate_isolate(dop_component_t* component) {
+    return gate_transition(component, DOP_GATE_ISOLATED);
+}
+
+bool dop_gate_is_accessible(const dop_component_t* component) {
+    if (!component) return false;
+    return atomic_load_explicit(&component->metadata.gate_state, memory_order_acquire) == DOP_GATE_OPEN;
+}
+
+int dop_gate_set_bulk(dop_component_t* const* components, size_t count, dop_gate_state_t state) {
+    if (!components && count > 0) return DOP_ERROR_INVALID_PARAMETER;
+    if (state != DOP_GATE_CLOSED && state != DOP_GATE_OPEN && state != DOP_GATE_ISOLATED) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    // One release fence orders all prior writes before every relaxed store below
+    atomic_thread_fence(memory_order_release);
+
+    int result = DOP_SUCCESS;
+    for (size_t i = 0; i < count; i++) {
+        dop_component_t* component = components[i];
+        if (!component) {
+            result = DOP_ERROR_INVALID_PARAMETER;
+            continue;
+        }
+        if (atomic_load_explicit(&component->metadata.gate_state, memory_order_relaxed) != state) {
+            atomic_store_explicit(&component->metadata.gate_state, state, memory_order_relaxed);
+            dop_journal_record(component, DOP_JOURNAL_GATE, (uint32_t)state);
+        }
+        if (component->store) {
+            dop_store_sync_gate(component, state);
+        }
+    }
+
+    return result;
+}
+
+// Error Handling
+const char* dop_error_to_string(dop_error_code_t error) {
+    switch (error) {
+        case DOP_SUCCESS: return "Success";
+        case DOP_ERROR_INVALID_PARAMETER: return "Invalid parameter";
+        case DOP_ERROR_INVALID_STATE: return "Invalid state";
+        case DOP_ERROR_MEMORY_ALLOCATION: return "Memory allocation failed";
+        case DOP_ERROR_GATE_CLOSED: return "Component gate is closed";
+        case DOP_ERROR_CHECKSUM_FAILED: return "Checksum verification failed";
+        case DOP_ERROR_TOPOLOGY_FAULT: return "Topology fault detected";
+        case DOP_ERROR_XML_PARSING: return "XML parsing error";
+        default: return "Unknown error";
+    }
+}
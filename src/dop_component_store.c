@@ -0,0 +1,603 @@
+// src/dop_component_store.c
+// OBINexus DOP Component Store Implementation
+// Structure-of-arrays storage with per-component views addressed by handle
+
+#include "dop_component_store.h"
+#include "dop_time.h"
+#include "dop_timing_wheel.h"
+#include "dop_alarm_index.h"
+#include "dop_tz.h"
+#include "dop_journal.h"
+#include "dop_metadata.h"
+#include "dop_slab.h"
+#include "dop_registry.h"
+#include "dop_wire.h"
+#include "dop_snapshot.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+
+// Column <-> View Conversion (callers hold the shard mutex)
+static void store_load_slot(const dop_store_shard_t* shard, uint32_t slot, dop_component_t* view) {
+    uint32_t flags = shard->flags[slot];
+
+    view->metadata.state = (dop_component_state_t)shard->state[slot];
+    atomic_store_explicit(&view->metadata.gate_state, (dop_gate_state_t)shard->gate[slot],
+                          memory_order_release);
+
+    switch (shard->type) {
+        case DOP_COMPONENT_CLOCK:
+            view->data.clock.current_time = shard->time_ms[slot];
+            view->data.clock.is_running = (flags & DOP_SLOT_RUNNING) != 0;
+            view->data.clock.timezone_offset = (int32_t)shard->param[slot];
+            view->data.clock.timezone_id = (uint16_t)(flags >> DOP_SLOT_ZONE_SHIFT);
+            view->data.clock.is_24_hour_format = (flags & DOP_SLOT_FORMAT_24H) != 0;
+            break;
+        case DOP_COMPONENT_ALARM:
+            view->data.alarm.current_time = shard->time_ms[slot];
+            view->data.alarm.alarm_time = shard->target_ms[slot];
+            view->data.alarm.is_armed = (flags & DOP_SLOT_ARMED) != 0;
+            view->data.alarm.is_triggered = (flags & DOP_SLOT_TRIGGERED) != 0;
+            view->data.alarm.snooze_duration_ms = (uint32_t)shard->param[slot];
+            view->data.alarm.repeat_days = (uint8_t)((flags & DOP_SLOT_REPEAT_MASK) >> DOP_SLOT_REPEAT_SHIFT);
+            break;
+        case DOP_COMPONENT_STOPWATCH:
+            view->data.stopwatch.start_time = shard->start_ms[slot];
+            view->data.stopwatch.current_time = shard->time_ms[slot];
+            view->data.stopwatch.elapsed_ms = shard->target_ms[slot];
+            view->data.stopwatch.is_running = (flags & DOP_SLOT_RUNNING) != 0;
+            view->data.stopwatch.is_paused = (flags & DOP_SLOT_PAUSED) != 0;
+            view->data.stopwatch.lap_count = (uint32_t)shard->param[slot];
+            view->data.stopwatch.start_ns = shard->start_ns[slot];
+            view->data.stopwatch.accumulated_ns = shard->span_ns[slot];
+            break;
+        case DOP_COMPONENT_TIMER:
+            view->data.timer.start_time = shard->start_ms[slot];
+            view->data.timer.start_ns = shard->start_ns[slot];
+            view->data.timer.duration_ns = shard->span_ns[slot];
+            view->data.timer.remaining_ns = shard->rest_ns[slot];
+            view->data.timer.is_running = (flags & DOP_SLOT_RUNNING) != 0;
+            view->data.timer.is_expired = (flags & DOP_SLOT_EXPIRED) != 0;
+            view->data.timer.auto_restart = (flags & DOP_SLOT_AUTO_RESTART) != 0;
+            view->data.timer.missed_periods = (uint32_t)shard->param[slot];
+            view->data.timer.periods = shard->target_ms[slot];
+            break;
+        default:
+            break;
+    }
+
+    view->checksum = dop_checksum_calculate(view);
+}
+
+static void store_save_slot(dop_store_shard_t* shard, uint32_t slot, const dop_component_t* view) {
+    uint32_t flags = DOP_SLOT_LIVE;
+
+    shard->state[slot] = (uint8_t)view->metadata.state;
+    shard->gate[slot] = (uint8_t)atomic_load_explicit(&view->metadata.gate_state, memory_order_acquire);
+
+    switch (shard->type) {
+        case DOP_COMPONENT_CLOCK:
+            shard->time_ms[slot] = view->data.clock.current_time;
+            shard->param[slot] = view->data.clock.timezone_offset;
+            flags |= (uint32_t)view->data.clock.timezone_id << DOP_SLOT_ZONE_SHIFT;
+            if (view->data.clock.is_running) flags |= DOP_SLOT_RUNNING;
+            if (view->data.clock.is_24_hour_format) flags |= DOP_SLOT_FORMAT_24H;
+            break;
+        case DOP_COMPONENT_ALARM:
+            shard->time_ms[slot] = view->data.alarm.current_time;
+            shard->target_ms[slot] = view->data.alarm.alarm_time;
+            shard->param[slot] = view->data.alarm.snooze_duration_ms;
+            if (view->data.alarm.is_armed) flags |= DOP_SLOT_ARMED;
+            if (view->data.alarm.is_triggered) flags |= DOP_SLOT_TRIGGERED;
+            flags |= ((uint32_t)view->data.alarm.repeat_days << DOP_SLOT_REPEAT_SHIFT) & DOP_SLOT_REPEAT_MASK;
+            break;
+        case DOP_COMPONENT_STOPWATCH:
+            shard->start_ms[slot] = view->data.stopwatch.start_time;
+            shard->time_ms[slot] = view->data.stopwatch.current_time;
+            shard->target_ms[slot] = view->data.stopwatch.elapsed_ms;
+            shard->param[slot] = view->data.stopwatch.lap_count;
+            shard->start_ns[slot] = view->data.stopwatch.start_ns;
+            shard->span_ns[slot] = view->data.stopwatch.accumulated_ns;
+            if (view->data.stopwatch.is_running) flags |= DOP_SLOT_RUNNING;
+            if (view->data.stopwatch.is_paused) flags |= DOP_SLOT_PAUSED;
+            break;
+        case DOP_COMPONENT_TIMER:
+            shard->start_ms[slot] = view->data.timer.start_time;
+            shard->start_ns[slot] = view->data.timer.start_ns;
+            shard->span_ns[slot] = view->data.timer.duration_ns;
+            shard->rest_ns[slot] = view->data.timer.remaining_ns;
+            shard->param[slot] = view->data.timer.missed_periods;
+            shard->target_ms[slot] = view->data.timer.periods;
+            if (view->data.timer.is_running) flags |= DOP_SLOT_RUNNING;
+            if (view->data.timer.is_expired) flags |= DOP_SLOT_EXPIRED;
+            if (view->data.timer.auto_restart) flags |= DOP_SLOT_AUTO_RESTART;
+            break;
+        default:
+            break;
+    }
+
+    shard->flags[slot] = flags;
+}
+
+static void store_free_view(dop_component_t* view) {
+    if (!view) return;
+    dop_timing_wheel_release(dop_timing_wheel_default(), view);
+    if (view->metadata.type == DOP_COMPONENT_ALARM) {
+        dop_alarm_index_remove(view);
+    }
+    view->metadata.state = DOP_STATE_DESTROYED;
+    dop_registry_remove(view);
+    dop_metadata_release(view->metadata.cold_index);
+    dop_slab_free(view);
+}
+
+static void store_init_slot(dop_store_shard_t* shard, uint32_t slot) {
+    uint64_t now_ms = dop_time_realtime_ms();
+
+    shard->time_ms[slot] = 0;
+    shard->start_ms[slot] = 0;
+    shard->target_ms[slot] = 0;
+    shard->param[slot] = 0;
+    shard->start_ns[slot] = 0;
+    shard->span_ns[slot] = 0;
+    shard->rest_ns[slot] = 0;
+    shard->flags[slot] = DOP_SLOT_LIVE;
+    shard->gate[slot] = DOP_GATE_CLOSED;
+    shard->state[slot] = DOP_STATE_READY;
+    shard->views[slot] = NULL;
+
+    // Defaults mirror dop_component_init()
+    switch (shard->type) {
+        case DOP_COMPONENT_CLOCK:
+            shard->time_ms[slot] = now_ms;
+            shard->param[slot] = dop_time_utc_offset(now_ms);
+            shard->flags[slot] |= DOP_SLOT_RUNNING | DOP_SLOT_FORMAT_24H;
+            break;
+        case DOP_COMPONENT_ALARM:
+            shard->time_ms[slot] = now_ms;
+            shard->param[slot] = 300000; // 5 minutes
+            break;
+        default:
+            break;
+    }
+}
+
+// Shard Locking
+void dop_store_lock_shard(dop_store_shard_t* shard) {
+    pthread_mutex_lock(&shard->mutex);
+    if (shard->restore) {
+        dop_snapshot_settle_shard(shard);
+    }
+}
+
+void dop_store_unlock_shard(dop_store_shard_t* shard) {
+    pthread_mutex_unlock(&shard->mutex);
+}
+
+uint32_t dop_store_slot_checksum(const dop_store_shard_t* shard, uint32_t slot) {
+    dop_component_t scratch;
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.metadata.type = shard->type;
+    scratch.checksum_algorithm = DOP_CHECKSUM_FIELDWISE;
+    store_load_slot(shard, slot, &scratch);
+    return scratch.checksum;
+}
+
+// Per-Type Update Kernels (callers hold the shard mutex)
+// Each returns true when the slot transitioned into a notable state.
+static inline bool store_update_slot(dop_store_shard_t* shard, uint32_t slot, uint64_t now_ms, uint64_t now_ns) {
+    uint32_t flags = shard->flags[slot];
+
+    if (!(flags & DOP_SLOT_LIVE) || shard->gate[slot] != DOP_GATE_OPEN) {
+        return false;
+    }
+
+    switch (shard->type) {
+        case DOP_COMPONENT_CLOCK: {
+            // Zone offsets are a hinted table lookup, never localtime_r()
+            shard->time_ms[slot] = now_ms;
+            uint16_t zone = (uint16_t)(flags >> DOP_SLOT_ZONE_SHIFT);
+            if (zone != DOP_TZ_FIXED) {
+                shard->param[slot] = dop_tz_offset(zone, now_ms);
+            }
+            return false;
+        }
+
+        case DOP_COMPONENT_ALARM: {
+            // Fires if an occurrence passed since the previous update;
+            // recurring alarms fire on every occurrence
+            uint64_t since_ms = shard->time_ms[slot];
+            shard->time_ms[slot] = now_ms;
+            if (!(flags & DOP_SLOT_ARMED) ||
+                ((flags & DOP_SLOT_TRIGGERED) && !(flags & DOP_SLOT_REPEAT_MASK))) {
+                return false;
+            }
+            dop_alarm_data_t alarm = {
+                .alarm_time = shard->target_ms[slot],
+                .repeat_days = (uint8_t)((flags & DOP_SLOT_REPEAT_MASK) >> DOP_SLOT_REPEAT_SHIFT)
+            };
+            // A slot with a view is scheduled through it: the pending
+            // occurrence (or snooze) is the one in the firing index, and
+            // firing it here moves the view's wheel and index entries on
+            dop_component_t* view = shard->views[slot];
+            dop_time_t due = view ? dop_alarm_index_time(view) :
+                             dop_alarm_crossed(&alarm, since_ms, now_ms) ? now_ms : DOP_ALARM_INDEX_NONE;
+            if (due > now_ms) return false;
+
+            shard->flags[slot] = flags | DOP_SLOT_TRIGGERED;
+            dop_journal_record_slot(DOP_HANDLE_MAKE(shard->type, shard->index, slot), DOP_JOURNAL_TRIGGER, 0);
+            if (view) dop_alarm_advance(view, &alarm, now_ms);
+            return true;
+        }
+
+        case DOP_COMPONENT_STOPWATCH:
+            if ((flags & (DOP_SLOT_RUNNING | DOP_SLOT_PAUSED)) == DOP_SLOT_RUNNING) {
+                shard->time_ms[slot] = now_ms;
+                shard->target_ms[slot] = (shard->span_ns[slot] + (now_ns - shard->start_ns[slot])) / DOP_NS_PER_MS;
+            }
+            return false;
+
+        case DOP_COMPONENT_TIMER:
+            if (flags & DOP_SLOT_RUNNING) {
+                shard->time_ms[slot] = now_ms;
+                uint64_t elapsed_ns = now_ns - shard->start_ns[slot];
+                uint64_t period_ns = shard->span_ns[slot];
+                if (elapsed_ns < period_ns) return false;
+
+                if ((flags & DOP_SLOT_AUTO_RESTART) && period_ns > 0) {
+                    // Rearm from the deadline that passed, not from now
+                    uint64_t ended = elapsed_ns / period_ns;
+                    shard->start_ns[slot] += ended * period_ns;
+                    shard->target_ms[slot] += ended;
+                    shard->param[slot] = shard->param[slot] + (int64_t)ended - 1 > (int64_t)UINT32_MAX ?
+                                         (int64_t)UINT32_MAX : shard->param[slot] + (int64_t)ended - 1;
+                    dop_journal_record_slot(DOP_HANDLE_MAKE(shard->type, shard->index, slot), DOP_JOURNAL_EXPIRE,
+                                            dop_journal_periods(ended));
+                } else {
+                    shard->flags[slot] = (flags & ~DOP_SLOT_RUNNING) | DOP_SLOT_EXPIRED;
+                    shard->rest_ns[slot] = 0;
+                    shard->target_ms[slot]++;
+                    dop_journal_record_slot(DOP_HANDLE_MAKE(shard->type, shard->index, slot), DOP_JOURNAL_EXPIRE, 1);
+                }
+
+                // The period this pass ended must not fire again from the view's wheel entry
+                dop_component_t* view = shard->views[slot];
+                if (view && (shard->flags[slot] & DOP_SLOT_RUNNING)) {
+                    dop_timing_wheel_schedule(dop_timing_wheel_default(), view,
+                                              (shard->start_ns[slot] + period_ns + DOP_NS_PER_MS - 1) / DOP_NS_PER_MS);
+                } else if (view) {
+                    dop_timing_wheel_cancel(dop_timing_wheel_default(), view);
+                }
+                return true;
+            }
+            return false;
+
+        default:
+            return false;
+    }
+}
+
+size_t dop_store_update_shard(dop_store_shard_t* shard, uint64_t now_ms, dop_handle_t* changed) {
+    if (!shard) return 0;
+
+    uint64_t now_ns = dop_time_monotonic_ns();
+    size_t changed_count = 0;
+    for (uint32_t slot = 0; slot < shard->high_water; slot++) {
+        if (store_update_slot(shard, slot, now_ms, now_ns) && changed) {
+            changed[changed_count++] = DOP_HANDLE_MAKE(shard->type, shard->index, slot);
+        }
+    }
+    return changed_count;
+}
+
+int dop_func_update_components(dop_component_store_t* store,
+                               const dop_handle_t* handles, size_t count,
+                               uint64_t now_ms,
+                               dop_handle_t* changed, size_t* changed_count) {
+    if (!store || (!handles && count > 0)) return DOP_ERROR_INVALID_PARAMETER;
+
+    uint64_t now_ns = dop_time_monotonic_ns();
+    size_t changes = 0;
+    dop_store_shard_t* locked = NULL;
+
+    for (size_t i = 0; i < count; i++) {
+        dop_store_shard_t* shard = dop_store_shard(store, handles[i]);
+        if (!shard) continue;
+
+        if (shard != locked) {
+            if (locked) dop_store_unlock_shard(locked);
+            dop_store_lock_shard(shard);
+            locked = shard;
+        }
+
+        uint32_t slot = DOP_HANDLE_SLOT(handles[i]);
+        if (slot < shard->high_water && store_update_slot(shard, slot, now_ms, now_ns) && changed) {
+            changed[changes++] = handles[i];
+        }
+    }
+
+    if (locked) dop_store_unlock_shard(locked);
+
+    if (changed_count) *changed_count = changes;
+    return DOP_SUCCESS;
+}
+
+// Store Lifecycle
+dop_component_store_t* dop_store_create(void) {
+    dop_component_store_t* store = calloc(1, sizeof(dop_component_store_t));
+    if (!store) return NULL;
+
+    pthread_mutex_init(&store->mutex, NULL);
+    return store;
+}
+
+void dop_store_destroy(dop_component_store_t* store) {
+    if (!store) return;
+
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        uint32_t shard_count = atomic_load_explicit(&store->shard_count[type], memory_order_relaxed);
+        for (uint32_t i = 0; i < shard_count; i++) {
+            dop_store_shard_t* shard = store->shards[type][i];
+            for (uint32_t slot = 0; slot < shard->high_water; slot++) {
+                store_free_view(shard->views[slot]);
+            }
+            pthread_mutex_destroy(&shard->mutex);
+            bool mapped = store->snapshot_base && (uint8_t*)shard >= store->snapshot_base &&
+                          (uint8_t*)shard < store->snapshot_base + store->snapshot_size;
+            if (!mapped) free(shard);
+        }
+    }
+
+    dop_snapshot_release(store);
+    pthread_mutex_destroy(&store->mutex);
+    free(store);
+}
+
+// Slot Management
+dop_handle_t dop_store_add(dop_component_store_t* store, dop_component_type_t type) {
+    if (!store || type >= DOP_COMPONENT_COUNT) return DOP_HANDLE_INVALID;
+
+    pthread_mutex_lock(&store->mutex);
+
+    // Find a shard with room, starting from the last one that had space
+    uint32_t shard_count = atomic_load_explicit(&store->shard_count[type], memory_order_relaxed);
+    dop_store_shard_t* shard = NULL;
+    for (uint32_t i = store->alloc_hint[type]; i < shard_count; i++) {
+        dop_store_shard_t* candidate = store->shards[type][i];
+        if (candidate->free_count > 0 || candidate->high_water < DOP_STORE_SHARD_CAPACITY) {
+            shard = candidate;
+            break;
+        }
+    }
+
+    if (!shard) {
+        if (shard_count >= DOP_STORE_MAX_SHARDS) {
+            pthread_mutex_unlock(&store->mutex);
+            return DOP_HANDLE_INVALID;
+        }
+
+        shard = calloc(1, sizeof(dop_store_shard_t));
+        if (!shard) {
+            pthread_mutex_unlock(&store->mutex);
+            return DOP_HANDLE_INVALID;
+        }
+
+        pthread_mutex_init(&shard->mutex, NULL);
+        shard->type = type;
+        shard->index = shard_count;
+        store->shards[type][shard->index] = shard;
+        // Release: lock-free readers that see the count see the shard
+        atomic_store_explicit(&store->shard_count[type], shard_count + 1, memory_order_release);
+    }
+    store->alloc_hint[type] = shard->index;
+
+    dop_store_lock_shard(shard);
+    uint32_t slot = shard->free_count > 0 ?
+                    shard->free_slots[--shard->free_count] :
+                    shard->high_water++;
+    store_init_slot(shard, slot);
+    shard->live_count++;
+    dop_store_unlock_shard(shard);
+
+    pthread_mutex_unlock(&store->mutex);
+
+    return DOP_HANDLE_MAKE(type, shard->index, slot);
+}
+
+int dop_store_remove(dop_component_store_t* store, dop_handle_t handle) {
+    if (!store || !dop_store_contains(store, handle)) return DOP_ERROR_INVALID_PARAMETER;
+
+    dop_store_shard_t* shard = dop_store_shard(store, handle);
+    uint32_t slot = DOP_HANDLE_SLOT(handle);
+
+    pthread_mutex_lock(&store->mutex);
+    dop_store_lock_shard(shard);
+
+    dop_component_t* view = shard->views[slot];
+    shard->views[slot] = NULL;
+    shard->flags[slot] = 0;
+    shard->state[slot] = DOP_STATE_DESTROYED;
+    shard->free_slots[shard->free_count++] = (uint16_t)slot;
+    shard->live_count--;
+
+    if (shard->index < store->alloc_hint[shard->type]) {
+        store->alloc_hint[shard->type] = shard->index;
+    }
+
+    dop_store_unlock_shard(shard);
+    pthread_mutex_unlock(&store->mutex);
+
+    store_free_view(view);
+    return DOP_SUCCESS;
+}
+
+bool dop_store_contains(const dop_component_store_t* store, dop_handle_t handle) {
+    dop_store_shard_t* shard = dop_store_shard(store, handle);
+    if (!shard) return false;
+
+    uint32_t slot = DOP_HANDLE_SLOT(handle);
+    return slot < shard->high_water && (shard->flags[slot] & DOP_SLOT_LIVE);
+}
+
+size_t dop_store_count(const dop_component_store_t* store, dop_component_type_t type) {
+    if (!store || type >= DOP_COMPONENT_COUNT) return 0;
+
+    size_t count = 0;
+    uint32_t shard_count = dop_store_shard_count(store, type);
+    for (uint32_t i = 0; i < shard_count; i++) {
+        count += store->shards[type][i]->live_count;
+    }
+    return count;
+}
+
+dop_store_shard_t* dop_store_shard(const dop_component_store_t* store, dop_handle_t handle) {
+    if (!store || handle == DOP_HANDLE_INVALID) return NULL;
+
+    dop_component_type_t type = DOP_HANDLE_TYPE(handle);
+    uint32_t index = DOP_HANDLE_SHARD(handle);
+    if (type >= DOP_COMPONENT_COUNT || index >= dop_store_shard_count(store, type)) return NULL;
+
+    return store->shards[type][index];
+}
+
+uint32_t dop_store_shard_count(const dop_component_store_t* store, dop_component_type_t type) {
+    if (!store || type >= DOP_COMPONENT_COUNT) return 0;
+    return atomic_load_explicit(&store->shard_count[type], memory_order_acquire);
+}
+
+// Per-Component Views
+dop_component_t* dop_store_view(dop_component_store_t* store, dop_handle_t handle) {
+    if (!dop_store_contains(store, handle)) return NULL;
+
+    dop_store_shard_t* shard = dop_store_shard(store, handle);
+    uint32_t slot = DOP_HANDLE_SLOT(handle);
+
+    dop_store_lock_shard(shard);
+    dop_component_t* view = shard->views[slot];
+    if (!view) {
+        view = dop_slab_alloc(shard->type);
+        if (!view) {
+            dop_store_unlock_shard(shard);
+            return NULL;
+        }
+        if (dop_component_init(view, shard->type) != DOP_SUCCESS) {
+            dop_store_unlock_shard(shard);
+            view->metadata.type = shard->type;
+            dop_slab_free(view);
+            return NULL;
+        }
+        view->store = store;
+        view->handle = handle;
+        shard->views[slot] = view;
+    }
+    dop_store_unlock_shard(shard);
+
+    // Taking the write lock refreshes the view from the columns
+    dop_component_write_lock(view);
+    dop_component_write_unlock(view);
+
+    return view;
+}
+
+int dop_store_refresh_view(dop_component_t* view) {
+    if (!view) return DOP_ERROR_INVALID_PARAMETER;
+    if (!view->store) return DOP_SUCCESS;
+
+    dop_store_shard_t* shard = dop_store_shard(view->store, view->handle);
+    if (!shard) return DOP_ERROR_INVALID_STATE;
+
+    // A removed slot keeps the view's last state until the view is freed
+    uint32_t slot = DOP_HANDLE_SLOT(view->handle);
+    dop_store_lock_shard(shard);
+    if (shard->flags[slot] & DOP_SLOT_LIVE) {
+        store_load_slot(shard, slot, view);
+    }
+    dop_store_unlock_shard(shard);
+
+    return DOP_SUCCESS;
+}
+
+int dop_store_sync_view(dop_component_t* view) {
+    if (!view) return DOP_ERROR_INVALID_PARAMETER;
+    if (!view->store) return DOP_SUCCESS;
+
+    dop_store_shard_t* shard = dop_store_shard(view->store, view->handle);
+    if (!shard) return DOP_ERROR_INVALID_STATE;
+
+    dop_store_lock_shard(shard);
+    store_save_slot(shard, DOP_HANDLE_SLOT(view->handle), view);
+    dop_store_unlock_shard(shard);
+
+    return DOP_SUCCESS;
+}
+
+int dop_store_sync_gate(const dop_component_t* view, dop_gate_state_t state) {
+    if (!view) return DOP_ERROR_INVALID_PARAMETER;
+    if (!view->store) return DOP_SUCCESS;
+
+    dop_store_shard_t* shard = dop_store_shard(view->store, view->handle);
+    if (!shard) return DOP_ERROR_INVALID_STATE;
+
+    dop_store_lock_shard(shard);
+    shard->gate[DOP_HANDLE_SLOT(view->handle)] = (uint8_t)state;
+    dop_store_unlock_shard(shard);
+
+    return DOP_SUCCESS;
+}
+
+// Bulk Serialization
+size_t dop_store_serialize(dop_component_store_t* store, void* buffer, size_t size) {
+    if (!store || !buffer || size < sizeof(dop_wire_header_t)) return 0;
+
+    uint8_t* cursor = (uint8_t*)buffer + sizeof(dop_wire_header_t);
+    uint8_t* end = (uint8_t*)buffer + size;
+    uint64_t sampled_ns = dop_time_monotonic_ns();
+    uint32_t record_count = 0;
+    dop_wire_record_t record;
+
+    // Slots are expanded into a scratch view so records match view encoding
+    dop_component_t scratch;
+    memset(&scratch, 0, sizeof(scratch));
+    scratch.checksum_algorithm = DOP_CHECKSUM_FIELDWISE;
+
+    pthread_mutex_lock(&store->mutex);
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        uint32_t shard_count = atomic_load_explicit(&store->shard_count[type], memory_order_relaxed);
+        for (uint32_t i = 0; i < shard_count; i++) {
+            dop_store_shard_t* shard = store->shards[type][i];
+            dop_store_lock_shard(shard);
+
+            for (uint32_t slot = 0; slot < shard->high_water; slot++) {
+                if (!(shard->flags[slot] & DOP_SLOT_LIVE)) continue;
+                if ((size_t)(end - cursor) < DOP_WIRE_RECORD_SIZE) {
+                    dop_store_unlock_shard(shard);
+                    pthread_mutex_unlock(&store->mutex);
+                    return 0;
+                }
+
+                dop_component_t* view = shard->views[slot];
+                scratch.metadata.type = shard->type;
+                scratch.metadata.cold_index = view ? view->metadata.cold_index : DOP_COLD_INVALID;
+                scratch.metadata.last_update_timestamp = view ? view->metadata.last_update_timestamp :
+                                                         shard->time_ms[slot];
+                scratch.handle = DOP_HANDLE_MAKE(shard->type, shard->index, slot);
+                memset(&scratch.data, 0, sizeof(scratch.data));
+                store_load_slot(shard, slot, &scratch);
+
+                dop_wire_pack(&record, &scratch, &scratch.data, sampled_ns);
+                memcpy(cursor, &record, DOP_WIRE_RECORD_SIZE);
+                cursor += DOP_WIRE_RECORD_SIZE;
+                record_count++;
+            }
+
+            dop_store_unlock_shard(shard);
+        }
+    }
+    pthread_mutex_unlock(&store->mutex);
+
+    dop_wire_header_t header;
+    dop_wire_header_init(&header, record_count);
+    memcpy(buffer, &header, sizeof(header));
+    return (size_t)(cursor - (uint8_t*)buffer);
+}
@@ -0,0 +1,464 @@
+// src/dop_deadline.c
+// OBINexus DOP Deadline Scheduler Implementation
+// Min-heap of per-component deadlines; only due components are updated
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dop_deadline.h"
+#include "dop_timing_wheel.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEADLINE_INITIAL_CAPACITY 64u
+#define DEADLINE_NOT_QUEUED       0xFFFFFFFFu
+#define DEADLINE_NS_PER_SECOND    1000000000ull
+
+typedef struct {
+    dop_component_t* component;
+    uint64_t deadline_ns;           // DOP_DEADLINE_IDLE while idle or being updated
+    uint32_t heap_index;            // Position in heap, or DEADLINE_NOT_QUEUED
+} dop_deadline_entry_t;
+
+struct dop_deadline_scheduler {
+    pthread_mutex_t mutex;          // Guards everything below except due
+    pthread_cond_t wake;            // Timed waits use CLOCK_MONOTONIC
+    pthread_mutex_t run_mutex;      // One due pass at a time; owns due
+    uint64_t refresh_ns[DOP_COMPONENT_COUNT];
+
+    dop_deadline_entry_t* entries;
+    size_t count;
+    size_t capacity;
+    uint32_t* heap;                 // Entry indices, min-heap on deadline_ns
+    size_t heap_count;
+
+    // Component -> entry index + 1 (0 = empty), linear probing
+    uint32_t* index;
+    size_t index_capacity;          // Power of two, at least twice count
+
+    dop_component_t** due;          // Scratch for run_due
+    size_t due_capacity;
+
+    uint64_t updates;
+    uint64_t passes;
+};
+
+// Component Index
+static inline size_t deadline_hash(const dop_component_t* component, size_t mask) {
+    return (size_t)((((uint64_t)(uintptr_t)component >> 6) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+}
+
+// Index slot holding component, or the empty slot where it would go
+static size_t deadline_slot(const dop_deadline_scheduler_t* scheduler, const dop_component_t* component) {
+    size_t mask = scheduler->index_capacity - 1;
+    size_t slot = deadline_hash(component, mask);
+
+    while (scheduler->index[slot] &&
+           scheduler->entries[scheduler->index[slot] - 1].component != component) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+static dop_deadline_entry_t* deadline_find(const dop_deadline_scheduler_t* scheduler,
+                                           const dop_component_t* component) {
+    if (!scheduler->index) return NULL;
+
+    uint32_t value = scheduler->index[deadline_slot(scheduler, component)];
+    return value ? &scheduler->entries[value - 1] : NULL;
+}
+
+// Backward-shift deletion keeps probe chains intact without tombstones
+static void deadline_index_erase(dop_deadline_scheduler_t* scheduler, size_t slot) {
+    size_t mask = scheduler->index_capacity - 1;
+    size_t hole = slot;
+
+    scheduler->index[hole] = 0;
+    for (size_t next = (hole + 1) & mask; scheduler->index[next]; next = (next + 1) & mask) {
+        size_t home = deadline_hash(scheduler->entries[scheduler->index[next] - 1].component, mask);
+        // Move the entry back unless its home lies cyclically in (hole, next]
+        bool stays = hole <= next ? (home > hole && home <= next) : (home > hole || home <= next);
+        if (!stays) {
+            scheduler->index[hole] = scheduler->index[next];
+            scheduler->index[next] = 0;
+            hole = next;
+        }
+    }
+}
+
+static int deadline_index_grow(dop_deadline_scheduler_t* scheduler) {
+    size_t capacity = scheduler->index_capacity ? scheduler->index_capacity * 2 : DEADLINE_INITIAL_CAPACITY * 2;
+    uint32_t* index = calloc(capacity, sizeof(uint32_t));
+    if (!index) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    free(scheduler->index);
+    scheduler->index = index;
+    scheduler->index_capacity = capacity;
+    for (size_t i = 0; i < scheduler->count; i++) {
+        scheduler->index[deadline_slot(scheduler, scheduler->entries[i].component)] = (uint32_t)i + 1;
+    }
+    return DOP_SUCCESS;
+}
+
+// Heap
+static inline bool deadline_before(const dop_deadline_scheduler_t* scheduler, uint32_t a, uint32_t b) {
+    return scheduler->entries[a].deadline_ns < scheduler->entries[b].deadline_ns;
+}
+
+static inline void deadline_heap_put(dop_deadline_scheduler_t* scheduler, size_t position, uint32_t entry) {
+    scheduler->heap[position] = entry;
+    scheduler->entries[entry].heap_index = (uint32_t)position;
+}
+
+static void deadline_sift_up(dop_deadline_scheduler_t* scheduler, size_t position) {
+    uint32_t entry = scheduler->heap[position];
+
+    while (position > 0) {
+        size_t parent = (position - 1) / 2;
+        if (!deadline_before(scheduler, entry, scheduler->heap[parent])) break;
+        deadline_heap_put(scheduler, position, scheduler->heap[parent]);
+        position = parent;
+    }
+    deadline_heap_put(scheduler, position, entry);
+}
+
+static void deadline_sift_down(dop_deadline_scheduler_t* scheduler, size_t position) {
+    uint32_t entry = scheduler->heap[position];
+
+    for (;;) {
+        size_t child = position * 2 + 1;
+        if (child >= scheduler->heap_count) break;
+        if (child + 1 < scheduler->heap_count &&
+            deadline_before(scheduler, scheduler->heap[child + 1], scheduler->heap[child])) {
+            child++;
+        }
+        if (!deadline_before(scheduler, scheduler->heap[child], entry)) break;
+        deadline_heap_put(scheduler, position, scheduler->heap[child]);
+        position = child;
+    }
+    deadline_heap_put(scheduler, position, entry);
+}
+
+static void deadline_heap_remove(dop_deadline_scheduler_t* scheduler, size_t position) {
+    scheduler->entries[scheduler->heap[position]].heap_index = DEADLINE_NOT_QUEUED;
+
+    uint32_t last = scheduler->heap[--scheduler->heap_count];
+    if (position == scheduler->heap_count) return;
+
+    deadline_heap_put(scheduler, position, last);
+    deadline_sift_up(scheduler, position);
+    deadline_sift_down(scheduler, scheduler->entries[last].heap_index);
+}
+
+// Caller holds mutex. Queues, moves or dequeues the entry.
+static void deadline_set_locked(dop_deadline_scheduler_t* scheduler, uint32_t entry, uint64_t deadline_ns) {
+    dop_deadline_entry_t* target = &scheduler->entries[entry];
+    uint64_t previous_ns = target->deadline_ns;
+    target->deadline_ns = deadline_ns;
+
+    if (target->heap_index == DEADLINE_NOT_QUEUED) {
+        if (deadline_ns == DOP_DEADLINE_IDLE) return;
+        deadline_heap_put(scheduler, scheduler->heap_count++, entry);
+        deadline_sift_up(scheduler, target->heap_index);
+    } else if (deadline_ns == DOP_DEADLINE_IDLE) {
+        deadline_heap_remove(scheduler, target->heap_index);
+        return;
+    } else if (deadline_ns < previous_ns) {
+        deadline_sift_up(scheduler, target->heap_index);
+    } else {
+        deadline_sift_down(scheduler, target->heap_index);
+    }
+
+    // A sleeping run_once may now have an earlier deadline to wait for
+    if (scheduler->heap[0] == entry) pthread_cond_broadcast(&scheduler->wake);
+}
+
+// Deadlines
+// Caller holds mutex. Next moment an update can change what the component reports.
+static uint64_t deadline_compute(const dop_deadline_scheduler_t* scheduler, const dop_component_t* component,
+                                 uint64_t now_ns) {
+    if (!dop_gate_is_accessible(component)) return DOP_DEADLINE_IDLE;
+
+    dop_component_data_t data;
+    dop_component_read_snapshot(component, &data);
+    uint64_t refresh_ns = scheduler->refresh_ns[component->metadata.type];
+
+    switch (component->metadata.type) {
+        case DOP_COMPONENT_CLOCK: {
+            if (!data.clock.is_running || refresh_ns == 0) return DOP_DEADLINE_IDLE;
+            // Land on wall-clock boundaries so the display turns over on time
+            uint64_t wall_ns = dop_time_realtime_ms() * DOP_NS_PER_MS;
+            return now_ns + (refresh_ns - wall_ns % refresh_ns);
+        }
+
+        case DOP_COMPONENT_STOPWATCH:
+            if (!data.stopwatch.is_running || data.stopwatch.is_paused || refresh_ns == 0) {
+                return DOP_DEADLINE_IDLE;
+            }
+            return now_ns + refresh_ns;
+
+        case DOP_COMPONENT_TIMER:
+            if (!data.timer.is_running) return DOP_DEADLINE_IDLE;
+            return data.timer.start_ns + data.timer.duration_ns;
+
+        case DOP_COMPONENT_ALARM: {
+            if (!data.alarm.is_armed || (data.alarm.is_triggered && !data.alarm.repeat_days)) {
+                return DOP_DEADLINE_IDLE;
+            }
+            uint64_t deadline_ms = dop_timing_wheel_deadline(dop_timing_wheel_default(), component);
+            return deadline_ms == UINT64_MAX ? DOP_DEADLINE_IDLE : deadline_ms * DOP_NS_PER_MS;
+        }
+
+        default:
+            return DOP_DEADLINE_IDLE;
+    }
+}
+
+// Scheduler Lifecycle
+dop_deadline_scheduler_t* dop_deadline_scheduler_create(void) {
+    dop_deadline_scheduler_t* scheduler = calloc(1, sizeof(dop_deadline_scheduler_t));
+    if (!scheduler) return NULL;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&scheduler->wake, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&scheduler->mutex, NULL);
+    pthread_mutex_init(&scheduler->run_mutex, NULL);
+
+    scheduler->refresh_ns[DOP_COMPONENT_CLOCK] = DOP_DEADLINE_CLOCK_REFRESH_NS;
+    scheduler->refresh_ns[DOP_COMPONENT_STOPWATCH] = DOP_DEADLINE_STOPWATCH_REFRESH_NS;
+    return scheduler;
+}
+
+void dop_deadline_scheduler_destroy(dop_deadline_scheduler_t* scheduler) {
+    if (!scheduler) return;
+
+    pthread_cond_destroy(&scheduler->wake);
+    pthread_mutex_destroy(&scheduler->mutex);
+    pthread_mutex_destroy(&scheduler->run_mutex);
+    free(scheduler->entries);
+    free(scheduler->heap);
+    free(scheduler->index);
+    free(scheduler->due);
+    free(scheduler);
+}
+
+int dop_deadline_set_refresh(dop_deadline_scheduler_t* scheduler, dop_component_type_t type, uint64_t interval_ns) {
+    if (!scheduler || (type != DOP_COMPONENT_CLOCK && type != DOP_COMPONENT_STOPWATCH)) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    pthread_mutex_lock(&scheduler->mutex);
+    scheduler->refresh_ns[type] = interval_ns;
+    pthread_mutex_unlock(&scheduler->mutex);
+    return DOP_SUCCESS;
+}
+
+// Tracking
+int dop_deadline_add(dop_deadline_scheduler_t* scheduler, dop_component_t* component) {
+    if (!scheduler || !component || component->metadata.type >= DOP_COMPONENT_COUNT) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    pthread_mutex_lock(&scheduler->mutex);
+    if (deadline_find(scheduler, component)) {
+        pthread_mutex_unlock(&scheduler->mutex);
+        return DOP_ERROR_INVALID_STATE;
+    }
+
+    if (scheduler->count == scheduler->capacity) {
+        size_t capacity = scheduler->capacity ? scheduler->capacity * 2 : DEADLINE_INITIAL_CAPACITY;
+        dop_deadline_entry_t* entries = realloc(scheduler->entries, capacity * sizeof(dop_deadline_entry_t));
+        if (entries) scheduler->entries = entries;
+        uint32_t* heap = entries ? realloc(scheduler->heap, capacity * sizeof(uint32_t)) : NULL;
+        if (!heap) {
+            pthread_mutex_unlock(&scheduler->mutex);
+            return DOP_ERROR_MEMORY_ALLOCATION;
+        }
+        scheduler->heap = heap;
+        scheduler->capacity = capacity;
+    }
+    if ((scheduler->count + 1) * 2 > scheduler->index_capacity &&
+        deadline_index_grow(scheduler) != DOP_SUCCESS) {
+        pthread_mutex_unlock(&scheduler->mutex);
+        return DOP_ERROR_MEMORY_ALLOCATION;
+    }
+
+    uint32_t entry = (uint32_t)scheduler->count++;
+    scheduler->entries[entry] = (dop_deadline_entry_t){
+        .component = component,
+        .deadline_ns = DOP_DEADLINE_IDLE,
+        .heap_index = DEADLINE_NOT_QUEUED
+    };
+    scheduler->index[deadline_slot(scheduler, component)] = entry + 1;
+    deadline_set_locked(scheduler, entry, deadline_compute(scheduler, component, dop_time_monotonic_ns()));
+
+    pthread_mutex_unlock(&scheduler->mutex);
+    return DOP_SUCCESS;
+}
+
+// Waits out a due pass in progress, which may hold the component in due
+int dop_deadline_remove(dop_deadline_scheduler_t* scheduler, dop_component_t* component) {
+    if (!scheduler || !component) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&scheduler->run_mutex);
+    pthread_mutex_lock(&scheduler->mutex);
+    dop_deadline_entry_t* target = deadline_find(scheduler, component);
+    if (!target) {
+        pthread_mutex_unlock(&scheduler->mutex);
+        pthread_mutex_unlock(&scheduler->run_mutex);
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    uint32_t entry = (uint32_t)(target - scheduler->entries);
+    if (target->heap_index != DEADLINE_NOT_QUEUED) deadline_heap_remove(scheduler, target->heap_index);
+    deadline_index_erase(scheduler, deadline_slot(scheduler, component));
+
+    // Fill the gap with the last entry
+    uint32_t last = (uint32_t)--scheduler->count;
+    if (entry != last) {
+        scheduler->entries[entry] = scheduler->entries[last];
+        scheduler->index[deadline_slot(scheduler, scheduler->entries[entry].component)] = entry + 1;
+        if (scheduler->entries[entry].heap_index != DEADLINE_NOT_QUEUED) {
+            scheduler->heap[scheduler->entries[entry].heap_index] = entry;
+        }
+    }
+
+    pthread_mutex_unlock(&scheduler->mutex);
+    pthread_mutex_unlock(&scheduler->run_mutex);
+    return DOP_SUCCESS;
+}
+
+int dop_deadline_touch(dop_deadline_scheduler_t* scheduler, dop_component_t* component) {
+    if (!scheduler || !component) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&scheduler->mutex);
+    dop_deadline_entry_t* target = deadline_find(scheduler, component);
+    if (target) {
+        deadline_set_locked(scheduler, (uint32_t)(target - scheduler->entries),
+                            deadline_compute(scheduler, component, dop_time_monotonic_ns()));
+    }
+    pthread_mutex_unlock(&scheduler->mutex);
+    return target ? DOP_SUCCESS : DOP_ERROR_INVALID_PARAMETER;
+}
+
+uint64_t dop_deadline_of(dop_deadline_scheduler_t* scheduler, const dop_component_t* component) {
+    if (!scheduler || !component) return DOP_DEADLINE_IDLE;
+
+    pthread_mutex_lock(&scheduler->mutex);
+    dop_deadline_entry_t* target = deadline_find(scheduler, component);
+    uint64_t deadline_ns = target ? target->deadline_ns : DOP_DEADLINE_IDLE;
+    pthread_mutex_unlock(&scheduler->mutex);
+    return deadline_ns;
+}
+
+// Caller holds mutex
+static inline uint64_t deadline_next_locked(const dop_deadline_scheduler_t* scheduler) {
+    return scheduler->heap_count ? scheduler->entries[scheduler->heap[0]].deadline_ns : DOP_DEADLINE_IDLE;
+}
+
+uint64_t dop_deadline_next(dop_deadline_scheduler_t* scheduler) {
+    if (!scheduler) return DOP_DEADLINE_IDLE;
+
+    pthread_mutex_lock(&scheduler->mutex);
+    uint64_t next = deadline_next_locked(scheduler);
+    pthread_mutex_unlock(&scheduler->mutex);
+    return next;
+}
+
+// Dispatch
+size_t dop_deadline_run_due(dop_deadline_scheduler_t* scheduler, uint64_t now_ns) {
+    if (!scheduler) return 0;
+
+    pthread_mutex_lock(&scheduler->run_mutex);
+    pthread_mutex_lock(&scheduler->mutex);
+
+    if (scheduler->due_capacity < scheduler->count) {
+        dop_component_t** due = realloc(scheduler->due, scheduler->capacity * sizeof(dop_component_t*));
+        if (due) {
+            scheduler->due = due;
+            scheduler->due_capacity = scheduler->capacity;
+        }
+    }
+
+    // Take everything due at once so rescheduling cannot revisit it this pass
+    size_t due_count = 0;
+    while (scheduler->heap_count && due_count < scheduler->due_capacity &&
+           deadline_next_locked(scheduler) <= now_ns) {
+        uint32_t entry = scheduler->heap[0];
+        scheduler->due[due_count++] = scheduler->entries[entry].component;
+        deadline_heap_remove(scheduler, 0);
+        scheduler->entries[entry].deadline_ns = DOP_DEADLINE_IDLE;
+    }
+    pthread_mutex_unlock(&scheduler->mutex);
+
+    // Component locks are taken without holding the scheduler. Alarms fire
+    // from the update itself, which moves them to their next occurrence.
+    size_t updated = 0;
+    for (size_t i = 0; i < due_count; i++) {
+        if (dop_func_update_component(scheduler->due[i]) == DOP_SUCCESS) updated++;
+    }
+
+    pthread_mutex_lock(&scheduler->mutex);
+    uint64_t resume_ns = dop_time_monotonic_ns();
+    for (size_t i = 0; i < due_count; i++) {
+        // Skip components removed meanwhile, and those a touch already rescheduled
+        dop_deadline_entry_t* target = deadline_find(scheduler, scheduler->due[i]);
+        if (!target || target->heap_index != DEADLINE_NOT_QUEUED) continue;
+        deadline_set_locked(scheduler, (uint32_t)(target - scheduler->entries),
+                            deadline_compute(scheduler, scheduler->due[i], resume_ns));
+    }
+    scheduler->updates += updated;
+    if (due_count) scheduler->passes++;
+    pthread_mutex_unlock(&scheduler->mutex);
+
+    pthread_mutex_unlock(&scheduler->run_mutex);
+    return updated;
+}
+
+int dop_deadline_run_once(dop_deadline_scheduler_t* scheduler, int timeout_ms, size_t* updated) {
+    if (!scheduler) return DOP_ERROR_INVALID_PARAMETER;
+
+    uint64_t now_ns = dop_time_monotonic_ns();
+    uint64_t timeout_ns = timeout_ms < 0 ? DOP_DEADLINE_IDLE : now_ns + (uint64_t)timeout_ms * DOP_NS_PER_MS;
+
+    pthread_mutex_lock(&scheduler->mutex);
+    for (;;) {
+        uint64_t next_ns = deadline_next_locked(scheduler);
+        if (next_ns <= now_ns) break;
+
+        uint64_t until_ns = next_ns < timeout_ns ? next_ns : timeout_ns;
+        if (until_ns <= now_ns) break;
+
+        if (until_ns == DOP_DEADLINE_IDLE) {
+            pthread_cond_wait(&scheduler->wake, &scheduler->mutex);
+        } else {
+            struct timespec wake = {
+                .tv_sec = (time_t)(until_ns / DEADLINE_NS_PER_SECOND),
+                .tv_nsec = (long)(until_ns % DEADLINE_NS_PER_SECOND)
+            };
+            pthread_cond_timedwait(&scheduler->wake, &scheduler->mutex, &wake);
+        }
+        now_ns = dop_time_monotonic_ns();
+    }
+    pthread_mutex_unlock(&scheduler->mutex);
+
+    size_t count = dop_deadline_run_due(scheduler, now_ns);
+    if (updated) *updated = count;
+    return DOP_SUCCESS;
+}
+
+int dop_deadline_get_stats(dop_deadline_scheduler_t* scheduler, dop_deadline_stats_t* stats) {
+    if (!scheduler || !stats) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&scheduler->mutex);
+    stats->tracked = scheduler->count;
+    stats->scheduled = scheduler->heap_count;
+    stats->updates = scheduler->updates;
+    stats->passes = scheduler->passes;
+    pthread_mutex_unlock(&scheduler->mutex);
+    return DOP_SUCCESS;
+}
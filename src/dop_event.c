@@ -0,0 +1,393 @@
+// src/dop_event.c
+// OBINexus DOP Event Loop Implementation
+// timerfd/epoll expiry notifications on top of the timing wheel
+
+#define _GNU_SOURCE
+#include "dop_event.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#define EVENT_INITIAL_BUCKETS 64u
+
+struct dop_event_subscription;
+
+typedef struct dop_event_member {
+    dop_component_t* component;
+    struct dop_event_subscription* subscription;
+    struct dop_event_member* next;       // Hash chain
+} dop_event_member_t;
+
+typedef struct dop_event_subscription {
+    dop_subscription_t id;
+    dop_event_callback_t callback;       // NULL for eventfd subscriptions
+    void* context;
+    int event_fd;
+    size_t member_count;
+    dop_event_member_t* members;
+    struct dop_event_subscription* next;
+} dop_event_subscription_t;
+
+struct dop_event_loop {
+    dop_timing_wheel_t* wheel;
+    int epoll_fd;
+    int timer_fd;
+    int stop_fd;
+
+    // Subscriptions are read on every dispatch and written rarely
+    pthread_rwlock_t lock;
+    dop_event_subscription_t* subscriptions;
+    dop_event_member_t** buckets;        // Component pointer -> members
+    size_t bucket_count;
+    size_t member_count;
+    dop_subscription_t next_id;
+
+    pthread_t thread;
+    bool thread_running;
+    atomic_bool stopping;
+};
+
+static inline size_t event_hash(const dop_component_t* component, size_t bucket_count) {
+    uint64_t key = (uint64_t)(uintptr_t)component;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return (size_t)key & (bucket_count - 1);
+}
+
+// Caller holds the write lock
+static int event_grow(dop_event_loop_t* loop, size_t bucket_count) {
+    dop_event_member_t** buckets = calloc(bucket_count, sizeof(dop_event_member_t*));
+    if (!buckets) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    for (size_t i = 0; i < loop->bucket_count; i++) {
+        dop_event_member_t* member = loop->buckets[i];
+        while (member) {
+            dop_event_member_t* next = member->next;
+            size_t index = event_hash(member->component, bucket_count);
+            member->next = buckets[index];
+            buckets[index] = member;
+            member = next;
+        }
+    }
+
+    free(loop->buckets);
+    loop->buckets = buckets;
+    loop->bucket_count = bucket_count;
+    return DOP_SUCCESS;
+}
+
+// Arms the timerfd to an absolute monotonic deadline; runs under the wheel lock
+static void event_arm(uint64_t next_deadline_ms, void* context) {
+    dop_event_loop_t* loop = context;
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+
+    if (next_deadline_ms != UINT64_MAX) {
+        spec.it_value.tv_sec = (time_t)(next_deadline_ms / 1000);
+        spec.it_value.tv_nsec = (long)(next_deadline_ms % 1000) * 1000000L;
+        if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0) {
+            spec.it_value.tv_nsec = 1; // Zero would disarm
+        }
+    }
+
+    timerfd_settime(loop->timer_fd, TFD_TIMER_ABSTIME, &spec, NULL);
+}
+
+// Wheel fire hook: fans one component out to its subscribers
+static void event_dispatch(dop_component_t* component, void* context) {
+    dop_event_loop_t* loop = context;
+    dop_event_kind_t kind;
+
+    switch (component->metadata.type) {
+        case DOP_COMPONENT_TIMER:
+            kind = DOP_EVENT_TIMER_EXPIRED;
+            break;
+        case DOP_COMPONENT_ALARM:
+            kind = DOP_EVENT_ALARM_TRIGGERED;
+            break;
+        default:
+            return;
+    }
+
+    pthread_rwlock_rdlock(&loop->lock);
+    if (loop->bucket_count > 0) {
+        dop_event_member_t* member = loop->buckets[event_hash(component, loop->bucket_count)];
+        for (; member; member = member->next) {
+            if (member->component != component) continue;
+
+            dop_event_subscription_t* subscription = member->subscription;
+            if (subscription->callback) {
+                subscription->callback(component, kind, subscription->context);
+            } else {
+                uint64_t one = 1;
+                ssize_t written = write(subscription->event_fd, &one, sizeof(one));
+                (void)written; // EAGAIN only when the counter saturates
+            }
+        }
+    }
+    pthread_rwlock_unlock(&loop->lock);
+}
+
+// Loop Lifecycle
+dop_event_loop_t* dop_event_loop_create(dop_timing_wheel_t* wheel) {
+    if (!wheel) wheel = dop_timing_wheel_default();
+    if (!wheel) return NULL;
+
+    dop_event_loop_t* loop = calloc(1, sizeof(dop_event_loop_t));
+    if (!loop) return NULL;
+
+    loop->wheel = wheel;
+    loop->next_id = 1;
+    atomic_init(&loop->stopping, false);
+    pthread_rwlock_init(&loop->lock, NULL);
+
+    loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    loop->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    loop->stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (loop->epoll_fd < 0 || loop->timer_fd < 0 || loop->stop_fd < 0) {
+        goto fail;
+    }
+
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.fd = loop->timer_fd;
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->timer_fd, &event) != 0) goto fail;
+    event.data.fd = loop->stop_fd;
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->stop_fd, &event) != 0) goto fail;
+
+    if (event_grow(loop, EVENT_INITIAL_BUCKETS) != DOP_SUCCESS) goto fail;
+
+    // Arms the timerfd immediately if deadlines are already pending
+    if (dop_timing_wheel_set_notify(wheel, event_arm, loop) != DOP_SUCCESS) goto fail;
+
+    return loop;
+
+fail:
+    if (loop->epoll_fd >= 0) close(loop->epoll_fd);
+    if (loop->timer_fd >= 0) close(loop->timer_fd);
+    if (loop->stop_fd >= 0) close(loop->stop_fd);
+    free(loop->buckets);
+    pthread_rwlock_destroy(&loop->lock);
+    free(loop);
+    return NULL;
+}
+
+void dop_event_loop_destroy(dop_event_loop_t* loop) {
+    if (!loop) return;
+
+    dop_event_loop_stop(loop);
+    dop_timing_wheel_set_notify(loop->wheel, NULL, NULL);
+
+    dop_event_subscription_t* subscription = loop->subscriptions;
+    while (subscription) {
+        dop_event_subscription_t* next = subscription->next;
+        free(subscription->members);
+        free(subscription);
+        subscription = next;
+    }
+
+    close(loop->epoll_fd);
+    close(loop->timer_fd);
+    close(loop->stop_fd);
+    free(loop->buckets);
+    pthread_rwlock_destroy(&loop->lock);
+    free(loop);
+}
+
+// Subscriptions
+static int event_add_subscription(dop_event_loop_t* loop,
+                                  dop_component_t* const* components, size_t count,
+                                  dop_event_callback_t callback, void* context, int event_fd,
+                                  dop_subscription_t* subscription_id) {
+    if (!loop || !components || count == 0) return DOP_ERROR_INVALID_PARAMETER;
+    for (size_t i = 0; i < count; i++) {
+        if (!components[i]) return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    dop_event_subscription_t* subscription = calloc(1, sizeof(dop_event_subscription_t));
+    dop_event_member_t* members = calloc(count, sizeof(dop_event_member_t));
+    if (!subscription || !members) {
+        free(subscription);
+        free(members);
+        return DOP_ERROR_MEMORY_ALLOCATION;
+    }
+
+    subscription->callback = callback;
+    subscription->context = context;
+    subscription->event_fd = event_fd;
+    subscription->member_count = count;
+    subscription->members = members;
+
+    pthread_rwlock_wrlock(&loop->lock);
+
+    size_t needed = loop->member_count + count;
+    if (needed > loop->bucket_count) {
+        size_t bucket_count = loop->bucket_count;
+        while (bucket_count < needed) bucket_count *= 2;
+        if (event_grow(loop, bucket_count) != DOP_SUCCESS) {
+            pthread_rwlock_unlock(&loop->lock);
+            free(members);
+            free(subscription);
+            return DOP_ERROR_MEMORY_ALLOCATION;
+        }
+    }
+
+    subscription->id = loop->next_id++;
+    if (loop->next_id == DOP_SUBSCRIPTION_INVALID) loop->next_id = 1;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t index = event_hash(components[i], loop->bucket_count);
+        members[i].component = components[i];
+        members[i].subscription = subscription;
+        members[i].next = loop->buckets[index];
+        loop->buckets[index] = &members[i];
+    }
+    loop->member_count += count;
+
+    subscription->next = loop->subscriptions;
+    loop->subscriptions = subscription;
+
+    pthread_rwlock_unlock(&loop->lock);
+
+    if (subscription_id) *subscription_id = subscription->id;
+    return DOP_SUCCESS;
+}
+
+int dop_event_subscribe(dop_event_loop_t* loop,
+                        dop_component_t* const* components, size_t count,
+                        dop_event_callback_t callback, void* context,
+                        dop_subscription_t* subscription) {
+    if (!callback) return DOP_ERROR_INVALID_PARAMETER;
+    return event_add_subscription(loop, components, count, callback, context, -1, subscription);
+}
+
+int dop_event_subscribe_eventfd(dop_event_loop_t* loop,
+                                dop_component_t* const* components, size_t count,
+                                int* event_fd, dop_subscription_t* subscription) {
+    if (!event_fd) return DOP_ERROR_INVALID_PARAMETER;
+
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) return DOP_ERROR_INVALID_STATE;
+
+    int result = event_add_subscription(loop, components, count, NULL, NULL, fd, subscription);
+    if (result != DOP_SUCCESS) {
+        close(fd);
+        return result;
+    }
+
+    *event_fd = fd;
+    return DOP_SUCCESS;
+}
+
+int dop_event_unsubscribe(dop_event_loop_t* loop, dop_subscription_t subscription_id) {
+    if (!loop || subscription_id == DOP_SUBSCRIPTION_INVALID) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_rwlock_wrlock(&loop->lock);
+
+    dop_event_subscription_t** link = &loop->subscriptions;
+    while (*link && (*link)->id != subscription_id) {
+        link = &(*link)->next;
+    }
+
+    dop_event_subscription_t* subscription = *link;
+    if (!subscription) {
+        pthread_rwlock_unlock(&loop->lock);
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    *link = subscription->next;
+
+    for (size_t i = 0; i < subscription->member_count; i++) {
+        dop_event_member_t* member = &subscription->members[i];
+        dop_event_member_t** chain = &loop->buckets[event_hash(member->component, loop->bucket_count)];
+        while (*chain != member) {
+            chain = &(*chain)->next;
+        }
+        *chain = member->next;
+    }
+    loop->member_count -= subscription->member_count;
+
+    pthread_rwlock_unlock(&loop->lock);
+
+    free(subscription->members);
+    free(subscription);
+    return DOP_SUCCESS;
+}
+
+// Dispatch
+int dop_event_loop_run_once(dop_event_loop_t* loop, int timeout_ms, size_t* fired) {
+    if (!loop) return DOP_ERROR_INVALID_PARAMETER;
+    if (fired) *fired = 0;
+
+    struct epoll_event events[2];
+    int ready = epoll_wait(loop->epoll_fd, events, 2, timeout_ms);
+    if (ready < 0) {
+        return errno == EINTR ? DOP_SUCCESS : DOP_ERROR_INVALID_STATE;
+    }
+
+    bool expired = false;
+    for (int i = 0; i < ready; i++) {
+        uint64_t counter;
+        if (events[i].data.fd == loop->timer_fd) {
+            expired = read(loop->timer_fd, &counter, sizeof(counter)) == sizeof(counter);
+        } else if (events[i].data.fd == loop->stop_fd) {
+            ssize_t drained = read(loop->stop_fd, &counter, sizeof(counter));
+            (void)drained;
+        }
+    }
+
+    if (expired) {
+        size_t count = dop_timing_wheel_advance(loop->wheel, dop_time_monotonic_ms(), event_dispatch, loop);
+        if (fired) *fired = count;
+    }
+
+    return DOP_SUCCESS;
+}
+
+static void* event_thread(void* arg) {
+    dop_event_loop_t* loop = arg;
+
+    while (!atomic_load_explicit(&loop->stopping, memory_order_acquire)) {
+        dop_event_loop_run_once(loop, -1, NULL);
+    }
+
+    return NULL;
+}
+
+int dop_event_loop_start(dop_event_loop_t* loop) {
+    if (!loop) return DOP_ERROR_INVALID_PARAMETER;
+    if (loop->thread_running) return DOP_ERROR_INVALID_STATE;
+
+    atomic_store_explicit(&loop->stopping, false, memory_order_release);
+    if (pthread_create(&loop->thread, NULL, event_thread, loop) != 0) {
+        return DOP_ERROR_INVALID_STATE;
+    }
+
+    loop->thread_running = true;
+    return DOP_SUCCESS;
+}
+
+int dop_event_loop_stop(dop_event_loop_t* loop) {
+    if (!loop) return DOP_ERROR_INVALID_PARAMETER;
+    if (!loop->thread_running) return DOP_SUCCESS;
+
+    atomic_store_explicit(&loop->stopping, true, memory_order_release);
+    uint64_t one = 1;
+    ssize_t written = write(loop->stop_fd, &one, sizeof(one));
+    (void)written;
+
+    pthread_join(loop->thread, NULL);
+    loop->thread_running = false;
+    return DOP_SUCCESS;
+}
+
+int dop_event_loop_fd(const dop_event_loop_t* loop) {
+    return loop ? loop->epoll_fd : -1;
+}
@@ -0,0 +1,230 @@
+// src/dop_journal.c
+// OBINexus DOP Change Journal Implementation
+// Per-thread single-producer rings drained by one consumer
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dop_journal.h"
+#include "dop_component_store.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+enum {
+    JOURNAL_RING_FREE = 0,
+    JOURNAL_RING_OWNED = 1
+};
+
+// Producer and consumer fields sit on separate cache lines; each side only
+// reads the other's index when its cached view runs out.
+typedef struct {
+    _Alignas(DOP_CACHE_LINE) _Atomic(uint64_t) tail;
+    uint64_t head_cache;            // Producer's last view of head
+    uint64_t sequence;              // Next event sequence, drops included
+    _Atomic(uint64_t) dropped;      // Written by the producer only
+    dop_journal_event_t* events;
+    uint32_t mask;
+    uint16_t index;
+
+    _Alignas(DOP_CACHE_LINE) _Atomic(uint64_t) head;
+    _Atomic(uint32_t) owner;        // JOURNAL_RING_*
+} dop_journal_ring_t;
+
+static _Atomic(dop_journal_ring_t*) g_journal_rings = NULL;
+static uint32_t g_journal_ring_count;
+static atomic_bool g_journal_enabled;
+static _Atomic(uint64_t) g_journal_unclaimed;   // Events dropped for want of a ring
+static _Atomic(uint64_t) g_journal_releases;    // Rings handed back by exiting threads
+static pthread_key_t g_journal_key;
+
+// Guards init and the consumer side
+static pthread_mutex_t g_journal_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t g_journal_drain_start;
+
+static _Thread_local dop_journal_ring_t* t_journal_ring;
+static _Thread_local uint64_t t_journal_miss;   // Releases + 1 at the last failed claim
+
+// Ring Ownership
+// The next owner carries on from the previous one's tail and sequence;
+// the owner word's release/acquire pair hands those fields over.
+static void journal_thread_exit(void* ring) {
+    atomic_store_explicit(&((dop_journal_ring_t*)ring)->owner, JOURNAL_RING_FREE, memory_order_release);
+    atomic_fetch_add_explicit(&g_journal_releases, 1, memory_order_release);
+}
+
+static dop_journal_ring_t* journal_claim(void) {
+    dop_journal_ring_t* rings = atomic_load_explicit(&g_journal_rings, memory_order_acquire);
+    if (!rings) return NULL;
+
+    // Rescan only once a ring has been released since the last miss
+    uint64_t releases = atomic_load_explicit(&g_journal_releases, memory_order_acquire);
+    if (t_journal_miss == releases + 1) return NULL;
+
+    for (uint32_t i = 0; i < g_journal_ring_count; i++) {
+        uint32_t expected = JOURNAL_RING_FREE;
+        if (atomic_load_explicit(&rings[i].owner, memory_order_relaxed) == JOURNAL_RING_FREE &&
+            atomic_compare_exchange_strong_explicit(&rings[i].owner, &expected, JOURNAL_RING_OWNED,
+                                                    memory_order_acquire, memory_order_relaxed)) {
+            t_journal_ring = &rings[i];
+            pthread_setspecific(g_journal_key, &rings[i]);
+            return &rings[i];
+        }
+    }
+
+    t_journal_miss = releases + 1;
+    return NULL;
+}
+
+// Recording
+static void journal_append(uint32_t cold_index, dop_handle_t handle, dop_component_type_t type,
+                           dop_journal_kind_t kind, uint32_t value) {
+    if (!atomic_load_explicit(&g_journal_enabled, memory_order_relaxed)) return;
+
+    dop_journal_ring_t* ring = t_journal_ring;
+    if (!ring && !(ring = journal_claim())) {
+        atomic_fetch_add_explicit(&g_journal_unclaimed, 1, memory_order_relaxed);
+        return;
+    }
+
+    uint64_t sequence = ring->sequence++;
+    uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail - ring->head_cache > ring->mask) {
+        ring->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail - ring->head_cache > ring->mask) {
+            uint64_t dropped = atomic_load_explicit(&ring->dropped, memory_order_relaxed);
+            atomic_store_explicit(&ring->dropped, dropped + 1, memory_order_relaxed);
+            return;
+        }
+    }
+
+    ring->events[tail & ring->mask] = (dop_journal_event_t){
+        .timestamp_ns = dop_time_monotonic_ns(),
+        .sequence = sequence,
+        .cold_index = cold_index,
+        .handle = handle,
+        .value = value,
+        .producer = ring->index,
+        .type = (uint8_t)type,
+        .kind = (uint8_t)kind
+    };
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+void dop_journal_record(const dop_component_t* component, dop_journal_kind_t kind, uint32_t value) {
+    if (!component) return;
+    journal_append(component->metadata.cold_index, component->handle, component->metadata.type, kind, value);
+}
+
+void dop_journal_record_slot(dop_handle_t handle, dop_journal_kind_t kind, uint32_t value) {
+    journal_append(DOP_COLD_INVALID, handle, DOP_HANDLE_TYPE(handle), kind, value);
+}
+
+// Journal Lifecycle
+int dop_journal_init(uint32_t ring_capacity, uint32_t ring_count) {
+    if (ring_capacity == 0 || ring_capacity > DOP_JOURNAL_MAX_CAPACITY ||
+        ring_count == 0 || ring_count > DOP_JOURNAL_MAX_RINGS) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    // At least two events keep each ring's storage a whole cache line
+    uint32_t capacity = 2;
+    while (capacity < ring_capacity) capacity <<= 1;
+
+    pthread_mutex_lock(&g_journal_mutex);
+    if (atomic_load_explicit(&g_journal_rings, memory_order_relaxed)) {
+        pthread_mutex_unlock(&g_journal_mutex);
+        return DOP_ERROR_INVALID_STATE;
+    }
+
+    dop_journal_ring_t* rings = aligned_alloc(DOP_CACHE_LINE, ring_count * sizeof(dop_journal_ring_t));
+    dop_journal_event_t* events = aligned_alloc(DOP_CACHE_LINE,
+                                                (size_t)ring_count * capacity * sizeof(dop_journal_event_t));
+    if (!rings || !events || pthread_key_create(&g_journal_key, journal_thread_exit) != 0) {
+        free(rings);
+        free(events);
+        pthread_mutex_unlock(&g_journal_mutex);
+        return DOP_ERROR_MEMORY_ALLOCATION;
+    }
+
+    memset(rings, 0, ring_count * sizeof(dop_journal_ring_t));
+    for (uint32_t i = 0; i < ring_count; i++) {
+        rings[i].events = events + (size_t)i * capacity;
+        rings[i].mask = capacity - 1;
+        rings[i].index = (uint16_t)i;
+    }
+
+    g_journal_ring_count = ring_count;
+    atomic_store_explicit(&g_journal_rings, rings, memory_order_release);
+    atomic_store_explicit(&g_journal_enabled, true, memory_order_release);
+    pthread_mutex_unlock(&g_journal_mutex);
+    return DOP_SUCCESS;
+}
+
+int dop_journal_set_enabled(bool enabled) {
+    if (!atomic_load_explicit(&g_journal_rings, memory_order_acquire)) return DOP_ERROR_INVALID_STATE;
+
+    atomic_store_explicit(&g_journal_enabled, enabled, memory_order_release);
+    return DOP_SUCCESS;
+}
+
+bool dop_journal_enabled(void) {
+    return atomic_load_explicit(&g_journal_enabled, memory_order_acquire);
+}
+
+// Draining
+// Head is published after every batch so producers regain room while the
+// consumer is still working through the other rings.
+size_t dop_journal_drain(dop_journal_consumer_t consumer, void* context, size_t max_events) {
+    dop_journal_ring_t* rings = atomic_load_explicit(&g_journal_rings, memory_order_acquire);
+    if (!consumer || !rings) return 0;
+
+    pthread_mutex_lock(&g_journal_mutex);
+
+    size_t drained = 0;
+    uint32_t start = g_journal_drain_start;
+    for (uint32_t visited = 0; visited < g_journal_ring_count && drained < max_events; visited++) {
+        dop_journal_ring_t* ring = &rings[(start + visited) % g_journal_ring_count];
+        uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        uint64_t available = atomic_load_explicit(&ring->tail, memory_order_acquire) - head;
+        if (available > max_events - drained) available = max_events - drained;
+
+        while (available > 0) {
+            uint64_t offset = head & ring->mask;
+            uint64_t batch = ring->mask + 1 - offset;
+            if (batch > available) batch = available;
+
+            consumer(&ring->events[offset], (size_t)batch, context);
+            head += batch;
+            available -= batch;
+            drained += (size_t)batch;
+            atomic_store_explicit(&ring->head, head, memory_order_release);
+        }
+    }
+    g_journal_drain_start = (start + 1) % g_journal_ring_count;
+
+    pthread_mutex_unlock(&g_journal_mutex);
+    return drained;
+}
+
+int dop_journal_stats(dop_journal_stats_t* stats) {
+    if (!stats) return DOP_ERROR_INVALID_PARAMETER;
+
+    memset(stats, 0, sizeof(*stats));
+    stats->dropped = atomic_load_explicit(&g_journal_unclaimed, memory_order_relaxed);
+
+    dop_journal_ring_t* rings = atomic_load_explicit(&g_journal_rings, memory_order_acquire);
+    if (!rings) return DOP_SUCCESS;
+
+    for (uint32_t i = 0; i < g_journal_ring_count; i++) {
+        uint64_t head = atomic_load_explicit(&rings[i].head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&rings[i].tail, memory_order_acquire);
+        stats->recorded += tail;
+        stats->pending += tail - head;
+        stats->dropped += atomic_load_explicit(&rings[i].dropped, memory_order_relaxed);
+        if (atomic_load_explicit(&rings[i].owner, memory_order_relaxed) == JOURNAL_RING_OWNED) {
+            stats->rings_owned++;
+        }
+    }
+    return DOP_SUCCESS;
+}
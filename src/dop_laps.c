@@ -0,0 +1,273 @@
+// src/dop_laps.c
+// OBINexus DOP Lap History Implementation
+// Arena-backed lap rings with an order-statistics index
+
+#include "dop_laps.h"
+#include "dop_metadata.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#define LAP_CLASS_COUNT   13u                   // Capacities 1 .. DOP_LAP_MAX_DEPTH
+#define LAP_ARENA_CHUNK   (256u * 1024u)
+#define LAP_ALIGN         16u
+
+struct dop_lap_ring {
+    uint32_t capacity;          // Power of two; entries in laps[] and sorted[]
+    uint32_t depth;             // Laps held at most, <= capacity
+    uint32_t head;              // Oldest held lap
+    uint32_t count;
+    uint8_t policy;             // dop_lap_overflow_t
+    uint8_t size_class;
+    uint64_t origin_ns;         // Split of the previous mark
+    uint64_t recorded;
+    uint64_t dropped;
+    uint64_t sum_ns;            // Of held lap durations
+    struct dop_lap_ring* next_free;
+    dop_lap_t* laps;            // Ring, indexed modulo capacity
+    uint64_t* sorted;           // Held lap durations, ascending
+};
+
+// Arena: rings are bump-allocated from chunks that are never returned, and
+// recycled through one free list per size class
+static pthread_mutex_t g_lap_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t* g_lap_chunk = NULL;
+static size_t g_lap_chunk_used = LAP_ARENA_CHUNK;
+static dop_lap_ring_t* g_lap_free[LAP_CLASS_COUNT];
+
+static inline size_t lap_header_size(void) {
+    return (sizeof(dop_lap_ring_t) + LAP_ALIGN - 1) & ~(size_t)(LAP_ALIGN - 1);
+}
+
+static inline size_t lap_block_size(uint32_t size_class) {
+    size_t capacity = (size_t)1 << size_class;
+    return lap_header_size() + capacity * (sizeof(dop_lap_t) + sizeof(uint64_t));
+}
+
+_Static_assert(((sizeof(dop_lap_t) + sizeof(uint64_t)) << (LAP_CLASS_COUNT - 1)) + 128 <= LAP_ARENA_CHUNK,
+               "largest lap ring fits in one arena chunk");
+
+// Caller holds g_lap_mutex
+static void* lap_arena_alloc_locked(size_t size) {
+    if (g_lap_chunk_used + size > LAP_ARENA_CHUNK) {
+        // The tail of the previous chunk is abandoned; at most one block
+        uint8_t* chunk = aligned_alloc(DOP_CACHE_LINE, LAP_ARENA_CHUNK);
+        if (!chunk) return NULL;
+        g_lap_chunk = chunk;
+        g_lap_chunk_used = 0;
+    }
+
+    void* block = g_lap_chunk + g_lap_chunk_used;
+    g_lap_chunk_used += (size + LAP_ALIGN - 1) & ~(size_t)(LAP_ALIGN - 1);
+    return block;
+}
+
+static dop_lap_ring_t* lap_ring_acquire(uint32_t depth, dop_lap_overflow_t policy) {
+    uint32_t size_class = 0;
+    while ((1u << size_class) < depth) size_class++;
+
+    pthread_mutex_lock(&g_lap_mutex);
+    dop_lap_ring_t* ring = g_lap_free[size_class];
+    if (ring) {
+        g_lap_free[size_class] = ring->next_free;
+    } else {
+        ring = lap_arena_alloc_locked(lap_block_size(size_class));
+    }
+    pthread_mutex_unlock(&g_lap_mutex);
+    if (!ring) return NULL;
+
+    uint8_t* storage = (uint8_t*)ring + lap_header_size();
+    memset(ring, 0, sizeof(*ring));
+    ring->capacity = 1u << size_class;
+    ring->depth = depth;
+    ring->policy = (uint8_t)policy;
+    ring->size_class = (uint8_t)size_class;
+    ring->laps = (dop_lap_t*)storage;
+    ring->sorted = (uint64_t*)(storage + ring->capacity * sizeof(dop_lap_t));
+    return ring;
+}
+
+void dop_lap_ring_release(dop_lap_ring_t* ring) {
+    if (!ring) return;
+
+    pthread_mutex_lock(&g_lap_mutex);
+    ring->next_free = g_lap_free[ring->size_class];
+    g_lap_free[ring->size_class] = ring;
+    pthread_mutex_unlock(&g_lap_mutex);
+}
+
+// Order-Statistics Index
+// First position whose value is greater than (upper) or not less than (lower) value
+static uint32_t lap_sorted_bound(const dop_lap_ring_t* ring, uint64_t value, bool upper) {
+    uint32_t low = 0;
+    uint32_t high = ring->count;
+
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        bool before = upper ? ring->sorted[middle] <= value : ring->sorted[middle] < value;
+        if (before) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// Ring Updates
+void dop_lap_ring_mark(dop_lap_ring_t* ring, uint64_t split_ns) {
+    if (!ring) return;
+
+    uint64_t lap_ns = split_ns - ring->origin_ns;
+    ring->origin_ns = split_ns;
+    ring->recorded++;
+
+    uint32_t mask = ring->capacity - 1;
+    if (ring->count == ring->depth) {
+        ring->dropped++;
+        if (ring->policy == DOP_LAP_DROP_NEWEST) return;
+
+        // Evict the oldest lap from the ring and the index
+        uint64_t evicted = ring->laps[ring->head].lap_ns;
+        uint32_t position = lap_sorted_bound(ring, evicted, false);
+        memmove(&ring->sorted[position], &ring->sorted[position + 1],
+                (ring->count - position - 1) * sizeof(uint64_t));
+        ring->head = (ring->head + 1) & mask;
+        ring->count--;
+        ring->sum_ns -= evicted;
+    }
+
+    uint32_t position = lap_sorted_bound(ring, lap_ns, true);
+    memmove(&ring->sorted[position + 1], &ring->sorted[position], (ring->count - position) * sizeof(uint64_t));
+    ring->sorted[position] = lap_ns;
+
+    ring->laps[(ring->head + ring->count) & mask] = (dop_lap_t){ .split_ns = split_ns, .lap_ns = lap_ns };
+    ring->count++;
+    ring->sum_ns += lap_ns;
+}
+
+void dop_lap_ring_restart(dop_lap_ring_t* ring) {
+    if (ring) ring->origin_ns = 0;
+}
+
+void dop_lap_ring_clear(dop_lap_ring_t* ring) {
+    if (!ring) return;
+
+    ring->head = 0;
+    ring->count = 0;
+    ring->origin_ns = 0;
+    ring->recorded = 0;
+    ring->dropped = 0;
+    ring->sum_ns = 0;
+}
+
+// History Configuration
+static dop_component_cold_t* lap_cold(const dop_component_t* component) {
+    if (!component || component->metadata.type != DOP_COMPONENT_STOPWATCH) return NULL;
+    return dop_metadata_cold(component->metadata.cold_index);
+}
+
+int dop_stopwatch_set_lap_history(dop_component_t* component, uint32_t depth, dop_lap_overflow_t policy) {
+    if (!component || component->metadata.type != DOP_COMPONENT_STOPWATCH || depth > DOP_LAP_MAX_DEPTH ||
+        (policy != DOP_LAP_OVERWRITE_OLDEST && policy != DOP_LAP_DROP_NEWEST)) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    dop_component_cold_t* cold = lap_cold(component);
+    if (!cold) return DOP_ERROR_INVALID_STATE;
+
+    dop_lap_ring_t* ring = NULL;
+    if (depth > 0) {
+        ring = lap_ring_acquire(depth, policy);
+        if (!ring) return DOP_ERROR_MEMORY_ALLOCATION;
+    }
+
+    // Swapped under the write lock so seqlock readers retry across the change
+    dop_component_write_lock(component);
+    dop_lap_ring_t* previous = atomic_exchange_explicit(&cold->lap_ring, ring, memory_order_release);
+    dop_component_write_unlock(component);
+
+    dop_lap_ring_release(previous);
+    return DOP_SUCCESS;
+}
+
+// Queries
+// Ring memory stays mapped for the process lifetime, so a reader racing a
+// release only ever sees stale values, which the sequence check rejects.
+// Torn counts are clamped first so no index leaves the ring meanwhile.
+static inline uint32_t lap_held(const dop_lap_ring_t* ring) {
+    uint32_t count = ring->count;
+    return count < ring->capacity ? count : ring->capacity;
+}
+
+int dop_stopwatch_lap_view(const dop_component_t* component, dop_lap_view_t* view) {
+    dop_component_cold_t* cold = lap_cold(component);
+    if (!cold || !view) return DOP_ERROR_INVALID_PARAMETER;
+
+    uint32_t sequence;
+    do {
+        sequence = dop_component_read_begin(component);
+        const dop_lap_ring_t* ring = atomic_load_explicit(&cold->lap_ring, memory_order_acquire);
+        memset(view, 0, sizeof(*view));
+        uint32_t count = ring ? lap_held(ring) : 0;
+        if (count > 0) {
+            uint32_t head = ring->head & (ring->capacity - 1);
+            uint32_t contiguous = ring->capacity - head;
+            view->first = &ring->laps[head];
+            view->first_count = count < contiguous ? count : contiguous;
+            view->second = ring->laps;
+            view->second_count = count - view->first_count;
+        }
+    } while (dop_component_read_retry(component, sequence));
+
+    return DOP_SUCCESS;
+}
+
+int dop_stopwatch_lap_stats(const dop_component_t* component, dop_lap_stats_t* stats) {
+    dop_component_cold_t* cold = lap_cold(component);
+    if (!cold || !stats) return DOP_ERROR_INVALID_PARAMETER;
+
+    uint32_t sequence;
+    do {
+        sequence = dop_component_read_begin(component);
+        const dop_lap_ring_t* ring = atomic_load_explicit(&cold->lap_ring, memory_order_acquire);
+        memset(stats, 0, sizeof(*stats));
+        if (ring) {
+            uint32_t count = lap_held(ring);
+            stats->count = count;
+            stats->recorded = ring->recorded;
+            stats->dropped = ring->dropped;
+            if (count > 0) {
+                stats->min_ns = ring->sorted[0];
+                stats->max_ns = ring->sorted[count - 1];
+                stats->mean_ns = ring->sum_ns / count;
+            }
+        }
+    } while (dop_component_read_retry(component, sequence));
+
+    return DOP_SUCCESS;
+}
+
+uint64_t dop_stopwatch_lap_percentile(const dop_component_t* component, double percentile) {
+    dop_component_cold_t* cold = lap_cold(component);
+    if (!cold || !(percentile >= 0.0 && percentile <= 100.0)) return 0;
+
+    uint32_t sequence;
+    uint64_t value;
+    do {
+        sequence = dop_component_read_begin(component);
+        const dop_lap_ring_t* ring = atomic_load_explicit(&cold->lap_ring, memory_order_acquire);
+        value = 0;
+        uint32_t count = ring ? lap_held(ring) : 0;
+        if (count > 0) {
+            // Nearest rank: the smallest value with at least p% of laps at or below it
+            double exact = percentile / 100.0 * count;
+            uint32_t rank = (uint32_t)exact;
+            if (rank < exact) rank++;
+            if (rank == 0) rank = 1;
+            value = ring->sorted[rank - 1];
+        }
+    } while (dop_component_read_retry(component, sequence));
+
+    return value;
+}
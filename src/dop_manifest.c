@@ -3,6 +3,7 @@
 // Corrected to match actual structure definitions
 
 #include "dop_manifest.h"
+#include "dop_registry.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -46,7 +47,7 @@ int dop_manifest_save_to_xml(const dop_build_topology_t* topology, const char* x
             fprintf(file, "        <dop:node_id>%s</dop:node_id>\n", node->node_id);
             if (node->component) {
                 fprintf(file, "        <dop:component_ref>%s</dop:component_ref>\n", 
-                        node->component->metadata.component_id);
+                        dop_component_id(node->component));
             }
             fprintf(file, "        <dop:is_fault_tolerant>%s</dop:is_fault_tolerant>\n",
                     node->is_fault_tolerant ? "true" : "false");
@@ -104,6 +105,19 @@ int dop_manifest_save_to_xml(const dop_build_topology_t* topology, const char* x
     return DOP_SUCCESS;
 }
 
+// Copies the text of a single-line <dop:tag>text</dop:tag> element
+static bool manifest_element_text(const char* line, const char* open_tag, char* out, size_t size) {
+    const char* start = strstr(line, open_tag);
+    if (!start) return false;
+    start += strlen(open_tag);
+    const char* end = strchr(start, '<');
+    if (!end || (size_t)(end - start) >= size) return false;
+    
+    memcpy(out, start, end - start);
+    out[end - start] = '\0';
+    return true;
+}
+
 int dop_manifest_load_from_xml(const char* xml_path, dop_build_topology_t* topology) {
     if (!xml_path || !topology) return DOP_ERROR_INVALID_PARAMETER;
     
@@ -112,6 +126,8 @@ int dop_manifest_load_from_xml(const char* xml_path, dop_build_topology_t* topol
     
     // Simplified XML parsing for demonstration
     char line[512];
+    char node_id[64] = "";
+    char component_ref[64];
     bool found_build_id = false;
     
     while (fgets(line, sizeof(line), file)) {
@@ -138,6 +154,19 @@ int dop_manifest_load_from_xml(const char* xml_path, dop_build_topology_t* topol
         if (strstr(line, "<dop:fault_tolerance>true</dop:fault_tolerance>")) {
             topology->is_fault_tolerant = true;
         }
+        
+        // Rebuild nodes whose component_ref names a live component
+        if (manifest_element_text(line, "<dop:node_id>", node_id, sizeof(node_id))) {
+            continue;
+        }
+        if (manifest_element_text(line, "<dop:component_ref>", component_ref, sizeof(component_ref))) {
+            dop_component_t* component = dop_registry_lookup(component_ref);
+            if (component && node_id[0] && topology->node_count < 16) {
+                dop_topology_node_t* node = dop_topology_create_node(node_id, component);
+                if (node) topology->nodes[topology->node_count++] = node;
+            }
+            node_id[0] = '\0';
+        }
     }
     
     fclose(file);
@@ -0,0 +1,233 @@
+// src/dop_metadata.c
+// OBINexus DOP Metadata Side Table Implementation
+// Interned identity strings and cold per-component metadata
+
+#include "dop_metadata.h"
+#include "dop_registry.h"
+#include "dop_laps.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+
+#define INTERN_INITIAL_CAPACITY 64u
+
+// Interned strings: open-addressing set, insert-only
+static pthread_mutex_t g_intern_mutex = PTHREAD_MUTEX_INITIALIZER;
+static const char** g_intern_slots = NULL;
+static size_t g_intern_capacity = 0;
+static size_t g_intern_count = 0;
+
+// Cold slots: chunks are never moved or freed once published
+static pthread_mutex_t g_cold_mutex = PTHREAD_MUTEX_INITIALIZER;
+static dop_component_cold_t* g_cold_chunks[DOP_COLD_MAX_CHUNKS];
+static uint32_t g_cold_high_water = 0;
+static uint32_t g_cold_free_head = DOP_COLD_INVALID;
+
+static uint64_t intern_hash(const char* text) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (; *text; text++) {
+        hash = (hash ^ (uint8_t)*text) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Caller holds g_intern_mutex
+static bool intern_grow(void) {
+    size_t capacity = g_intern_capacity ? g_intern_capacity * 2 : INTERN_INITIAL_CAPACITY;
+    const char** slots = calloc(capacity, sizeof(const char*));
+    if (!slots) return false;
+
+    for (size_t i = 0; i < g_intern_capacity; i++) {
+        if (!g_intern_slots[i]) continue;
+        size_t index = intern_hash(g_intern_slots[i]) & (capacity - 1);
+        while (slots[index]) index = (index + 1) & (capacity - 1);
+        slots[index] = g_intern_slots[i];
+    }
+
+    free(g_intern_slots);
+    g_intern_slots = slots;
+    g_intern_capacity = capacity;
+    return true;
+}
+
+// String Interning
+const char* dop_intern_string(const char* text) {
+    if (!text) return NULL;
+
+    pthread_mutex_lock(&g_intern_mutex);
+
+    if ((g_intern_count + 1) * 2 > g_intern_capacity && !intern_grow()) {
+        pthread_mutex_unlock(&g_intern_mutex);
+        return NULL;
+    }
+
+    size_t index = intern_hash(text) & (g_intern_capacity - 1);
+    while (g_intern_slots[index]) {
+        if (strcmp(g_intern_slots[index], text) == 0) {
+            const char* existing = g_intern_slots[index];
+            pthread_mutex_unlock(&g_intern_mutex);
+            return existing;
+        }
+        index = (index + 1) & (g_intern_capacity - 1);
+    }
+
+    size_t length = strlen(text) + 1;
+    char* copy = malloc(length);
+    if (copy) {
+        memcpy(copy, text, length);
+        g_intern_slots[index] = copy;
+        g_intern_count++;
+    }
+
+    pthread_mutex_unlock(&g_intern_mutex);
+    return copy;
+}
+
+// Side-Table Slots
+// Caller holds g_cold_mutex
+static uint32_t cold_acquire_locked(void) {
+    uint32_t index = g_cold_free_head;
+    if (index != DOP_COLD_INVALID) {
+        g_cold_free_head = dop_metadata_cold(index)->next_free;
+    } else {
+        index = g_cold_high_water;
+        uint32_t chunk = index >> DOP_COLD_CHUNK_BITS;
+        if (chunk >= DOP_COLD_MAX_CHUNKS) return DOP_COLD_INVALID;
+        if (!g_cold_chunks[chunk]) {
+            g_cold_chunks[chunk] = calloc(DOP_COLD_CHUNK_SIZE, sizeof(dop_component_cold_t));
+            if (!g_cold_chunks[chunk]) return DOP_COLD_INVALID;
+        }
+        g_cold_high_water++;
+    }
+
+    dop_component_cold_t* cold = dop_metadata_cold(index);
+    cold->next_free = DOP_COLD_INVALID;
+    atomic_store_explicit(&cold->lap_ring, NULL, memory_order_relaxed);
+    cold->alarm_position = UINT32_MAX;
+    return index;
+}
+
+// Caller holds g_cold_mutex
+static void cold_release_locked(uint32_t cold_index) {
+    dop_component_cold_t* cold = cold_index < g_cold_high_water ? dop_metadata_cold(cold_index) : NULL;
+    if (!cold) return;
+
+    dop_lap_ring_t* ring = atomic_exchange_explicit(&cold->lap_ring, NULL, memory_order_relaxed);
+    dop_lap_ring_release(ring);
+    cold->next_free = g_cold_free_head;
+    g_cold_free_head = cold_index;
+}
+
+uint32_t dop_metadata_acquire(void) {
+    pthread_mutex_lock(&g_cold_mutex);
+    uint32_t index = cold_acquire_locked();
+    if (index != DOP_COLD_INVALID) {
+        dop_component_cold_t* cold = dop_metadata_cold(index);
+        memset(cold->component_id, 0, sizeof(cold->component_id));
+        atomic_store_explicit(&cold->component_name, "", memory_order_relaxed);
+        atomic_store_explicit(&cold->version, "", memory_order_relaxed);
+        cold->creation_timestamp = 0;
+    }
+    pthread_mutex_unlock(&g_cold_mutex);
+    return index;
+}
+
+void dop_metadata_release(uint32_t cold_index) {
+    pthread_mutex_lock(&g_cold_mutex);
+    cold_release_locked(cold_index);
+    pthread_mutex_unlock(&g_cold_mutex);
+}
+
+size_t dop_metadata_clone(uint32_t source_index, dop_component_t* const* components, size_t count) {
+    const dop_component_cold_t* source = dop_metadata_cold(source_index);
+    if (!source || !components) return 0;
+
+    size_t filled = 0;
+    pthread_mutex_lock(&g_cold_mutex);
+    for (; filled < count; filled++) {
+        uint32_t index = cold_acquire_locked();
+        if (index == DOP_COLD_INVALID) break;
+
+        dop_component_cold_t* cold = dop_metadata_cold(index);
+        memcpy(cold->component_id, source->component_id, sizeof(cold->component_id));
+        atomic_store_explicit(&cold->component_name,
+                              atomic_load_explicit(&source->component_name, memory_order_relaxed),
+                              memory_order_relaxed);
+        atomic_store_explicit(&cold->version,
+                              atomic_load_explicit(&source->version, memory_order_relaxed),
+                              memory_order_relaxed);
+        cold->creation_timestamp = source->creation_timestamp;
+        components[filled]->metadata.cold_index = index;
+    }
+    pthread_mutex_unlock(&g_cold_mutex);
+    return filled;
+}
+
+void dop_metadata_release_batch(dop_component_t* const* components, size_t count) {
+    if (!components) return;
+
+    pthread_mutex_lock(&g_cold_mutex);
+    for (size_t i = 0; i < count; i++) {
+        if (components[i]) cold_release_locked(components[i]->metadata.cold_index);
+    }
+    pthread_mutex_unlock(&g_cold_mutex);
+}
+
+dop_component_cold_t* dop_metadata_cold(uint32_t cold_index) {
+    if (cold_index == DOP_COLD_INVALID) return NULL;
+
+    dop_component_cold_t* chunk = g_cold_chunks[cold_index >> DOP_COLD_CHUNK_BITS];
+    return chunk ? &chunk[cold_index & (DOP_COLD_CHUNK_SIZE - 1)] : NULL;
+}
+
+// Component Accessors
+const char* dop_component_id(const dop_component_t* component) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    return cold ? cold->component_id : "";
+}
+
+const char* dop_component_name(const dop_component_t* component) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    return cold ? atomic_load_explicit(&cold->component_name, memory_order_acquire) : "";
+}
+
+const char* dop_component_version(const dop_component_t* component) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    return cold ? atomic_load_explicit(&cold->version, memory_order_acquire) : "";
+}
+
+uint64_t dop_component_creation_timestamp(const dop_component_t* component) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    return cold ? cold->creation_timestamp : 0;
+}
+
+int dop_component_set_id(dop_component_t* component, const char* component_id) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    if (!cold || !component_id) return DOP_ERROR_INVALID_PARAMETER;
+
+    // IDs are unique; the registry owns writes to component_id
+    return dop_registry_bind(component, component_id);
+}
+
+int dop_component_set_name(dop_component_t* component, const char* component_name) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    if (!cold || !component_name) return DOP_ERROR_INVALID_PARAMETER;
+
+    const char* interned = dop_intern_string(component_name);
+    if (!interned) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    atomic_store_explicit(&cold->component_name, interned, memory_order_release);
+    return DOP_SUCCESS;
+}
+
+int dop_component_set_version(dop_component_t* component, const char* version) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    if (!cold || !version) return DOP_ERROR_INVALID_PARAMETER;
+
+    const char* interned = dop_intern_string(version);
+    if (!interned) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    atomic_store_explicit(&cold->version, interned, memory_order_release);
+    return DOP_SUCCESS;
+}
@@ -0,0 +1,344 @@
+// src/dop_registry.c
+// OBINexus DOP Component Registry Implementation
+// Unique component IDs and lock-free ID lookup
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dop_registry.h"
+#include "dop_metadata.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdatomic.h>
+#include <sched.h>
+
+#define REGISTRY_INITIAL_CAPACITY 256u
+#define REGISTRY_RECLAIM_BATCH    64u
+#define REGISTRY_KEY_POOL_MAX     1024u
+
+// Interned binding: never modified once published, so a probe compares IDs
+// without touching the component's cold slot, which a rebind rewrites
+typedef struct dop_registry_key {
+    uint64_t hash;
+    dop_component_t* component;
+    struct dop_registry_key* retired;       // Limbo list link
+    char id[];
+} dop_registry_key_t;
+
+// Keys are all one size, so reclaimed ones are pooled for the next bind
+#define REGISTRY_KEY_SIZE (sizeof(dop_registry_key_t) + sizeof(((dop_component_cold_t*)0)->component_id))
+
+typedef struct {
+    _Atomic(dop_registry_key_t*) key;       // NULL = empty, or REGISTRY_TOMBSTONE
+} dop_registry_slot_t;
+
+typedef struct dop_registry_table {
+    size_t capacity;                        // Power of two
+    struct dop_registry_table* retired;     // Limbo list link
+    dop_registry_slot_t slots[];
+} dop_registry_table_t;
+
+static pthread_mutex_t g_registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+static _Atomic(dop_registry_table_t*) g_registry_table = NULL;
+static size_t g_registry_live = 0;      // Bound slots
+static size_t g_registry_used = 0;      // Bound slots plus tombstones
+static _Atomic(uint64_t) g_registry_serial = 0;
+
+// Read epochs: lookups count themselves in the current epoch's parity.
+// Unbound keys and replaced tables wait in limbo until a flip drains it.
+static _Atomic(uint64_t) g_registry_epoch = 0;
+static _Atomic(uint64_t) g_registry_readers[2];
+static dop_registry_key_t* g_limbo_keys = NULL;
+static dop_registry_table_t* g_limbo_tables = NULL;
+static size_t g_limbo_count = 0;
+static dop_registry_key_t* g_key_pool = NULL;
+static size_t g_key_pool_count = 0;
+
+static char g_registry_tombstone;
+#define REGISTRY_TOMBSTONE ((dop_registry_key_t*)(void*)&g_registry_tombstone)
+
+static uint64_t registry_hash(const char* text) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (; *text; text++) {
+        hash = (hash ^ (uint8_t)*text) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Epochs
+// Entry and flip are sequentially consistent: either the flip sees the
+// reader's count, or the reader sees the new epoch and re-enters under it
+static uint64_t registry_read_enter(void) {
+    for (;;) {
+        uint64_t epoch = atomic_load(&g_registry_epoch);
+        atomic_fetch_add(&g_registry_readers[epoch & 1], 1);
+        if (atomic_load(&g_registry_epoch) == epoch) return epoch;
+        atomic_fetch_sub_explicit(&g_registry_readers[epoch & 1], 1, memory_order_release);
+    }
+}
+
+static void registry_read_exit(uint64_t epoch) {
+    atomic_fetch_sub_explicit(&g_registry_readers[epoch & 1], 1, memory_order_release);
+}
+
+// Caller holds g_registry_mutex. Everything in limbo was unlinked before
+// the flip, so once the old parity drains no lookup can still reach it.
+static void registry_reclaim_locked(void) {
+    if (!g_limbo_keys && !g_limbo_tables) return;
+
+    uint64_t epoch = atomic_load(&g_registry_epoch);
+    atomic_store(&g_registry_epoch, epoch + 1);
+    while (atomic_load(&g_registry_readers[epoch & 1]) != 0) {
+        sched_yield();
+    }
+    atomic_thread_fence(memory_order_acquire);
+
+    while (g_limbo_keys) {
+        dop_registry_key_t* key = g_limbo_keys;
+        g_limbo_keys = key->retired;
+        if (g_key_pool_count < REGISTRY_KEY_POOL_MAX) {
+            key->retired = g_key_pool;
+            g_key_pool = key;
+            g_key_pool_count++;
+        } else {
+            free(key);
+        }
+    }
+    while (g_limbo_tables) {
+        dop_registry_table_t* table = g_limbo_tables;
+        g_limbo_tables = table->retired;
+        free(table);
+    }
+    g_limbo_count = 0;
+}
+
+// Caller holds g_registry_mutex. Drains limbo once enough has built up.
+static void registry_writer_done_locked(void) {
+    if (g_limbo_count >= REGISTRY_RECLAIM_BATCH) registry_reclaim_locked();
+}
+
+// Caller holds g_registry_mutex. An empty pool first takes back whatever
+// limbo holds, so a create/destroy cycle reuses the key it unbound.
+static dop_registry_key_t* registry_key_alloc_locked(void) {
+    if (!g_key_pool && g_limbo_keys) registry_reclaim_locked();
+
+    dop_registry_key_t* key = g_key_pool;
+    if (!key) return malloc(REGISTRY_KEY_SIZE);
+    g_key_pool = key->retired;
+    g_key_pool_count--;
+    return key;
+}
+
+// Component bound to component_id, or NULL. Safe without the writer lock
+// inside a read epoch.
+static dop_component_t* registry_probe(dop_registry_table_t* table, uint64_t hash, const char* component_id) {
+    size_t mask = table->capacity - 1;
+    for (size_t index = hash & mask;; index = (index + 1) & mask) {
+        dop_registry_key_t* key = atomic_load_explicit(&table->slots[index].key, memory_order_acquire);
+        if (!key) return NULL;
+        if (key != REGISTRY_TOMBSTONE && key->hash == hash && strcmp(key->id, component_id) == 0) {
+            return key->component;
+        }
+    }
+}
+
+// Caller holds g_registry_mutex. Drops the component's current binding.
+static void registry_unlink_locked(dop_registry_table_t* table, const dop_component_t* component) {
+    uint64_t hash = registry_hash(dop_component_id(component));
+    size_t mask = table->capacity - 1;
+
+    for (size_t index = hash & mask;; index = (index + 1) & mask) {
+        dop_registry_slot_t* slot = &table->slots[index];
+        dop_registry_key_t* key = atomic_load_explicit(&slot->key, memory_order_relaxed);
+        if (!key) return;
+        if (key != REGISTRY_TOMBSTONE && key->component == component) {
+            atomic_store_explicit(&slot->key, REGISTRY_TOMBSTONE, memory_order_release);
+            key->retired = g_limbo_keys;
+            g_limbo_keys = key;
+            g_limbo_count++;
+            g_registry_live--;
+            return;
+        }
+    }
+}
+
+// Caller holds g_registry_mutex and has reserved room
+static void registry_insert_locked(dop_registry_table_t* table, dop_registry_key_t* key) {
+    size_t mask = table->capacity - 1;
+    size_t index = key->hash & mask;
+    dop_registry_key_t* current;
+
+    while ((current = atomic_load_explicit(&table->slots[index].key, memory_order_relaxed)) &&
+           current != REGISTRY_TOMBSTONE) {
+        index = (index + 1) & mask;
+    }
+
+    // Release: readers that observe the key observe its contents
+    atomic_store_explicit(&table->slots[index].key, key, memory_order_release);
+    if (!current) g_registry_used++;
+    g_registry_live++;
+}
+
+// Caller holds g_registry_mutex. Keeps occupancy at or below 3/4; a full
+// rebuild also clears tombstones. Returns the table to insert into.
+static dop_registry_table_t* registry_reserve_locked(void) {
+    dop_registry_table_t* table = atomic_load_explicit(&g_registry_table, memory_order_relaxed);
+    if (table && (g_registry_used + 1) * 4 <= table->capacity * 3) return table;
+
+    size_t capacity = table ? table->capacity : REGISTRY_INITIAL_CAPACITY;
+    while ((g_registry_live + 1) * 2 > capacity) capacity *= 2;
+
+    dop_registry_table_t* fresh = calloc(1, sizeof(dop_registry_table_t) + capacity * sizeof(dop_registry_slot_t));
+    if (!fresh) return NULL;
+    fresh->capacity = capacity;
+
+    // Keys move to the new table as they are; only the old table retires
+    g_registry_live = 0;
+    g_registry_used = 0;
+    if (table) {
+        for (size_t i = 0; i < table->capacity; i++) {
+            dop_registry_key_t* key = atomic_load_explicit(&table->slots[i].key, memory_order_relaxed);
+            if (key && key != REGISTRY_TOMBSTONE) {
+                registry_insert_locked(fresh, key);
+            }
+        }
+    }
+
+    atomic_store_explicit(&g_registry_table, fresh, memory_order_release);
+    if (table) {
+        table->retired = g_limbo_tables;
+        g_limbo_tables = table;
+        g_limbo_count++;
+    }
+    return fresh;
+}
+
+// Caller holds g_registry_mutex. id is already truncated to the cold slot size.
+static int registry_bind_locked(dop_registry_table_t* table, dop_component_t* component,
+                                dop_component_cold_t* cold, const char* id, uint64_t hash) {
+    dop_component_t* holder = registry_probe(table, hash, id);
+    if (holder) return holder == component ? DOP_SUCCESS : DOP_ERROR_INVALID_STATE;
+
+    dop_registry_key_t* key = registry_key_alloc_locked();
+    if (!key) return DOP_ERROR_MEMORY_ALLOCATION;
+    key->hash = hash;
+    key->component = component;
+    key->retired = NULL;
+    memcpy(key->id, id, strlen(id) + 1);
+
+    registry_unlink_locked(table, component);
+    memcpy(cold->component_id, id, sizeof(cold->component_id));
+    registry_insert_locked(table, key);
+    return DOP_SUCCESS;
+}
+
+// Caller holds g_registry_mutex
+static int registry_assign_locked(dop_component_t* component) {
+    dop_component_cold_t* cold = dop_metadata_cold(component->metadata.cold_index);
+    if (!cold) return DOP_ERROR_INVALID_PARAMETER;
+
+    dop_registry_table_t* table = registry_reserve_locked();
+    if (!table) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    // Skip serials whose ID was already claimed explicitly
+    char key[sizeof(cold->component_id)];
+    uint64_t hash;
+    do {
+        snprintf(key, sizeof(key), "comp_%d_%llu", component->metadata.type,
+                 (unsigned long long)dop_registry_next_serial());
+        hash = registry_hash(key);
+    } while (registry_probe(table, hash, key));
+
+    return registry_bind_locked(table, component, cold, key, hash);
+}
+
+// Generated Identity
+uint64_t dop_registry_next_serial(void) {
+    return atomic_fetch_add_explicit(&g_registry_serial, 1, memory_order_relaxed) + 1;
+}
+
+int dop_registry_assign(dop_component_t* component) {
+    if (!component) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&g_registry_mutex);
+    int result = registry_assign_locked(component);
+    registry_writer_done_locked();
+    pthread_mutex_unlock(&g_registry_mutex);
+    return result;
+}
+
+size_t dop_registry_assign_batch(dop_component_t* const* components, size_t count) {
+    if (!components) return 0;
+
+    size_t assigned = 0;
+    pthread_mutex_lock(&g_registry_mutex);
+    while (assigned < count && components[assigned] &&
+           registry_assign_locked(components[assigned]) == DOP_SUCCESS) {
+        assigned++;
+    }
+    registry_writer_done_locked();
+    pthread_mutex_unlock(&g_registry_mutex);
+    return assigned;
+}
+
+// Binding
+int dop_registry_bind(dop_component_t* component, const char* component_id) {
+    dop_component_cold_t* cold = component ? dop_metadata_cold(component->metadata.cold_index) : NULL;
+    if (!cold || !component_id) return DOP_ERROR_INVALID_PARAMETER;
+
+    char key[sizeof(cold->component_id)];
+    snprintf(key, sizeof(key), "%s", component_id);
+    uint64_t hash = registry_hash(key);
+
+    pthread_mutex_lock(&g_registry_mutex);
+    dop_registry_table_t* table = registry_reserve_locked();
+    int result = table ? registry_bind_locked(table, component, cold, key, hash) : DOP_ERROR_MEMORY_ALLOCATION;
+    registry_writer_done_locked();
+    pthread_mutex_unlock(&g_registry_mutex);
+    return result;
+}
+
+void dop_registry_remove(const dop_component_t* component) {
+    if (!component) return;
+
+    pthread_mutex_lock(&g_registry_mutex);
+    dop_registry_table_t* table = atomic_load_explicit(&g_registry_table, memory_order_relaxed);
+    if (table) registry_unlink_locked(table, component);
+    registry_writer_done_locked();
+    pthread_mutex_unlock(&g_registry_mutex);
+}
+
+void dop_registry_remove_batch(dop_component_t* const* components, size_t count) {
+    if (!components) return;
+
+    pthread_mutex_lock(&g_registry_mutex);
+    dop_registry_table_t* table = atomic_load_explicit(&g_registry_table, memory_order_relaxed);
+    for (size_t i = 0; table && i < count; i++) {
+        if (components[i]) registry_unlink_locked(table, components[i]);
+    }
+    registry_writer_done_locked();
+    pthread_mutex_unlock(&g_registry_mutex);
+}
+
+// Lookup
+dop_component_t* dop_registry_lookup(const char* component_id) {
+    if (!component_id) return NULL;
+
+    uint64_t epoch = registry_read_enter();
+    dop_registry_table_t* table = atomic_load_explicit(&g_registry_table, memory_order_acquire);
+    dop_component_t* component = table ? registry_probe(table, registry_hash(component_id), component_id) : NULL;
+    registry_read_exit(epoch);
+    return component;
+}
+
+dop_handle_t dop_registry_resolve(const char* component_id) {
+    dop_component_t* component = dop_registry_lookup(component_id);
+    return component ? component->handle : DOP_HANDLE_INVALID;
+}
+
+size_t dop_registry_count(void) {
+    pthread_mutex_lock(&g_registry_mutex);
+    size_t count = g_registry_live;
+    pthread_mutex_unlock(&g_registry_mutex);
+    return count;
+}
@@ -0,0 +1,413 @@
+// src/dop_scheduler.c
+// OBINexus DOP Scheduler Implementation
+// Work-stealing parallel-for over component ranges
+
+#define _GNU_SOURCE
+
+#include "dop_scheduler.h"
+#include "dop_wire.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <unistd.h>
+
+// Halving a 32-bit range never leaves more than 32 pending halves on one
+// deque; a full deque runs the remainder inline instead
+#define SCHED_DEQUE_CAPACITY 64u
+#define SCHED_DEQUE_MASK     (SCHED_DEQUE_CAPACITY - 1)
+
+// A range is packed into one word so deque slots can be plain atomics
+#define SCHED_RANGE(begin, end)  (((uint64_t)(begin) << 32) | (uint64_t)(end))
+#define SCHED_RANGE_BEGIN(range) ((size_t)((range) >> 32))
+#define SCHED_RANGE_END(range)   ((size_t)((range) & 0xFFFFFFFFu))
+
+// Chase-Lev deque: the owner pushes and takes at bottom, thieves take at top
+typedef struct {
+    _Alignas(DOP_CACHE_LINE) _Atomic(int64_t) top;
+    _Alignas(DOP_CACHE_LINE) _Atomic(int64_t) bottom;
+    _Atomic(uint64_t) ranges[SCHED_DEQUE_CAPACITY];
+} dop_sched_deque_t;
+
+typedef struct {
+    dop_sched_deque_t deque;
+    pthread_t thread;
+    uint32_t index;
+    uint64_t rng;                   // Victim selection, owner only
+    _Atomic(uint64_t) ranges;
+    _Atomic(uint64_t) steals;
+    struct dop_scheduler* scheduler;
+} dop_sched_worker_t;
+
+struct dop_scheduler {
+    pthread_mutex_t run_mutex;      // One parallel-for at a time
+    pthread_mutex_t job_mutex;      // Guards generation, job_open, shutdown
+    pthread_cond_t job_cond;
+    uint64_t generation;
+    bool job_open;
+    bool shutdown;
+    _Atomic(uint32_t) active;       // Helper workers inside the current job
+    _Atomic(size_t) remaining;      // Components not yet processed
+
+    // Current job; written before the generation bump, stable until active drops to 0
+    dop_component_t* const* components;
+    size_t grain;
+    dop_range_fn_t fn;
+    void* context;
+
+    uint32_t worker_count;
+    dop_sched_worker_t* workers;
+};
+
+// Deque Operations
+static bool deque_push(dop_sched_deque_t* deque, uint64_t range) {
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (bottom - top >= (int64_t)SCHED_DEQUE_CAPACITY) return false;
+
+    atomic_store_explicit(&deque->ranges[bottom & SCHED_DEQUE_MASK], range, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+static bool deque_take(dop_sched_deque_t* deque, uint64_t* range) {
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *range = atomic_load_explicit(&deque->ranges[bottom & SCHED_DEQUE_MASK], memory_order_relaxed);
+    if (top < bottom) return true;
+
+    // Last entry: race thieves for it
+    bool won = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                       memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return won;
+}
+
+static bool deque_steal(dop_sched_deque_t* deque, uint64_t* range) {
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) return false;
+
+    uint64_t value = atomic_load_explicit(&deque->ranges[top & SCHED_DEQUE_MASK], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return false;
+    }
+    *range = value;
+    return true;
+}
+
+// Work Loop
+static inline uint64_t sched_next_random(dop_sched_worker_t* worker) {
+    uint64_t x = worker->rng;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    worker->rng = x;
+    return x;
+}
+
+static bool sched_steal(dop_scheduler_t* scheduler, dop_sched_worker_t* worker, uint64_t* range) {
+    uint32_t count = scheduler->worker_count;
+    if (count < 2) return false;
+
+    // One sweep from a random start visits every victim once
+    uint32_t start = (uint32_t)(sched_next_random(worker) % count);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t victim = (start + i) % count;
+        if (victim == worker->index) continue;
+        if (deque_steal(&scheduler->workers[victim].deque, range)) {
+            atomic_fetch_add_explicit(&worker->steals, 1, memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Splits off upper halves for thieves, then runs what is left
+static void sched_run_range(dop_scheduler_t* scheduler, dop_sched_worker_t* worker, uint64_t range) {
+    size_t begin = SCHED_RANGE_BEGIN(range);
+    size_t end = SCHED_RANGE_END(range);
+
+    while (end - begin > scheduler->grain) {
+        size_t middle = begin + (end - begin) / 2;
+        if (!deque_push(&worker->deque, SCHED_RANGE(middle, end))) break;
+        end = middle;
+    }
+
+    scheduler->fn(scheduler->components, begin, end, scheduler->context);
+    atomic_fetch_add_explicit(&worker->ranges, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&scheduler->remaining, end - begin, memory_order_acq_rel);
+}
+
+static void sched_work(dop_scheduler_t* scheduler, dop_sched_worker_t* worker) {
+    uint64_t range;
+
+    while (atomic_load_explicit(&scheduler->remaining, memory_order_acquire) > 0) {
+        if (deque_take(&worker->deque, &range) || sched_steal(scheduler, worker, &range)) {
+            sched_run_range(scheduler, worker, range);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+static void* sched_worker(void* arg) {
+    dop_sched_worker_t* worker = arg;
+    dop_scheduler_t* scheduler = worker->scheduler;
+    uint64_t seen = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&scheduler->job_mutex);
+        while (!scheduler->shutdown && (!scheduler->job_open || scheduler->generation == seen)) {
+            pthread_cond_wait(&scheduler->job_cond, &scheduler->job_mutex);
+        }
+        if (scheduler->shutdown) {
+            pthread_mutex_unlock(&scheduler->job_mutex);
+            break;
+        }
+        seen = scheduler->generation;
+        atomic_fetch_add_explicit(&scheduler->active, 1, memory_order_relaxed);
+        pthread_mutex_unlock(&scheduler->job_mutex);
+
+        sched_work(scheduler, worker);
+        atomic_fetch_sub_explicit(&scheduler->active, 1, memory_order_release);
+    }
+
+    return NULL;
+}
+
+// Caller holds job_mutex
+static void sched_shutdown_locked(dop_scheduler_t* scheduler, uint32_t started) {
+    scheduler->shutdown = true;
+    pthread_cond_broadcast(&scheduler->job_cond);
+    pthread_mutex_unlock(&scheduler->job_mutex);
+
+    // Worker 0 is the calling thread
+    for (uint32_t i = 1; i < started; i++) {
+        pthread_join(scheduler->workers[i].thread, NULL);
+    }
+}
+
+// Scheduler Lifecycle
+dop_scheduler_t* dop_scheduler_create(uint32_t worker_count) {
+    if (worker_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = online > 0 ? (uint32_t)online : 1;
+    }
+
+    dop_scheduler_t* scheduler = calloc(1, sizeof(dop_scheduler_t));
+    if (!scheduler) return NULL;
+
+    scheduler->workers = aligned_alloc(DOP_CACHE_LINE, worker_count * sizeof(dop_sched_worker_t));
+    if (!scheduler->workers) {
+        free(scheduler);
+        return NULL;
+    }
+    memset(scheduler->workers, 0, worker_count * sizeof(dop_sched_worker_t));
+    scheduler->worker_count = worker_count;
+
+    pthread_mutex_init(&scheduler->run_mutex, NULL);
+    pthread_mutex_init(&scheduler->job_mutex, NULL);
+    pthread_cond_init(&scheduler->job_cond, NULL);
+    atomic_init(&scheduler->active, 0);
+    atomic_init(&scheduler->remaining, 0);
+
+    for (uint32_t i = 0; i < worker_count; i++) {
+        dop_sched_worker_t* worker = &scheduler->workers[i];
+        atomic_init(&worker->deque.top, 0);
+        atomic_init(&worker->deque.bottom, 0);
+        atomic_init(&worker->ranges, 0);
+        atomic_init(&worker->steals, 0);
+        worker->index = i;
+        worker->rng = 0x9E3779B97F4A7C15ull * (i + 1);
+        worker->scheduler = scheduler;
+    }
+
+    for (uint32_t i = 1; i < worker_count; i++) {
+        if (pthread_create(&scheduler->workers[i].thread, NULL, sched_worker, &scheduler->workers[i]) != 0) {
+            pthread_mutex_lock(&scheduler->job_mutex);
+            sched_shutdown_locked(scheduler, i);
+            dop_scheduler_destroy(scheduler);
+            return NULL;
+        }
+    }
+
+    return scheduler;
+}
+
+void dop_scheduler_destroy(dop_scheduler_t* scheduler) {
+    if (!scheduler) return;
+
+    pthread_mutex_lock(&scheduler->job_mutex);
+    if (!scheduler->shutdown) {
+        sched_shutdown_locked(scheduler, scheduler->worker_count);
+    } else {
+        pthread_mutex_unlock(&scheduler->job_mutex);
+    }
+
+    pthread_cond_destroy(&scheduler->job_cond);
+    pthread_mutex_destroy(&scheduler->job_mutex);
+    pthread_mutex_destroy(&scheduler->run_mutex);
+    free(scheduler->workers);
+    free(scheduler);
+}
+
+uint32_t dop_scheduler_worker_count(const dop_scheduler_t* scheduler) {
+    return scheduler ? scheduler->worker_count : 0;
+}
+
+// Parallel-For
+int dop_parallel_for(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                     size_t grain, dop_range_fn_t fn, void* context) {
+    if (!scheduler || (!components && count > 0) || !fn || count > UINT32_MAX) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+    if (count == 0) return DOP_SUCCESS;
+
+    pthread_mutex_lock(&scheduler->run_mutex);
+
+    scheduler->components = components;
+    scheduler->grain = grain ? grain : DOP_SCHEDULER_DEFAULT_GRAIN;
+    scheduler->fn = fn;
+    scheduler->context = context;
+    atomic_store_explicit(&scheduler->remaining, count, memory_order_relaxed);
+
+    dop_sched_worker_t* caller = &scheduler->workers[0];
+    deque_push(&caller->deque, SCHED_RANGE(0, count));
+
+    if (scheduler->worker_count > 1) {
+        pthread_mutex_lock(&scheduler->job_mutex);
+        scheduler->job_open = true;
+        scheduler->generation++;
+        pthread_cond_broadcast(&scheduler->job_cond);
+        pthread_mutex_unlock(&scheduler->job_mutex);
+    }
+
+    sched_work(scheduler, caller);
+
+    if (scheduler->worker_count > 1) {
+        // Helpers that have not woken yet stay asleep; wait out the rest
+        pthread_mutex_lock(&scheduler->job_mutex);
+        scheduler->job_open = false;
+        pthread_mutex_unlock(&scheduler->job_mutex);
+        while (atomic_load_explicit(&scheduler->active, memory_order_acquire) > 0) {
+            sched_yield();
+        }
+    }
+
+    pthread_mutex_unlock(&scheduler->run_mutex);
+    return DOP_SUCCESS;
+}
+
+// Component Jobs
+typedef struct {
+    _Atomic(size_t) count;
+} sched_count_context_t;
+
+static void sched_update_range(dop_component_t* const* components, size_t begin, size_t end, void* context) {
+    sched_count_context_t* updated = context;
+    size_t local = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        if (dop_func_update_component(components[i]) == DOP_SUCCESS) local++;
+    }
+    atomic_fetch_add_explicit(&updated->count, local, memory_order_relaxed);
+}
+
+static void sched_validate_range(dop_component_t* const* components, size_t begin, size_t end, void* context) {
+    sched_count_context_t* failed = context;
+    size_t local = 0;
+
+    for (size_t i = begin; i < end; i++) {
+        if (dop_component_validate_integrity(components[i]) != DOP_SUCCESS) local++;
+    }
+    if (local) atomic_fetch_add_explicit(&failed->count, local, memory_order_relaxed);
+}
+
+typedef struct {
+    uint8_t* records;
+    uint64_t sampled_ns;            // Shared by the whole stream
+    _Atomic(bool) invalid;
+} sched_serialize_context_t;
+
+static void sched_serialize_range(dop_component_t* const* components, size_t begin, size_t end, void* context) {
+    sched_serialize_context_t* stream = context;
+    dop_wire_record_t record;
+    dop_component_data_t data;
+
+    for (size_t i = begin; i < end; i++) {
+        const dop_component_t* component = components[i];
+        if (!component || component->metadata.type >= DOP_COMPONENT_COUNT) {
+            atomic_store_explicit(&stream->invalid, true, memory_order_relaxed);
+            continue;
+        }
+        dop_component_read_snapshot(component, &data);
+        dop_wire_pack(&record, component, &data, stream->sampled_ns);
+        memcpy(stream->records + i * DOP_WIRE_RECORD_SIZE, &record, DOP_WIRE_RECORD_SIZE);
+    }
+}
+
+int dop_parallel_update(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                        size_t* updated) {
+    sched_count_context_t context;
+    atomic_init(&context.count, 0);
+
+    int result = dop_parallel_for(scheduler, components, count, 0, sched_update_range, &context);
+    if (result == DOP_SUCCESS && updated) *updated = atomic_load(&context.count);
+    return result;
+}
+
+int dop_parallel_validate(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                          size_t* failed) {
+    sched_count_context_t context;
+    atomic_init(&context.count, 0);
+
+    int result = dop_parallel_for(scheduler, components, count, 0, sched_validate_range, &context);
+    if (result != DOP_SUCCESS) return result;
+
+    size_t failures = atomic_load(&context.count);
+    if (failed) *failed = failures;
+    return failures ? DOP_ERROR_CHECKSUM_FAILED : DOP_SUCCESS;
+}
+
+size_t dop_parallel_serialize(dop_scheduler_t* scheduler, dop_component_t* const* components, size_t count,
+                              void* buffer, size_t size) {
+    if (!buffer || count > UINT32_MAX || size < DOP_WIRE_STREAM_SIZE(count)) return 0;
+
+    dop_wire_header_t header;
+    dop_wire_header_init(&header, (uint32_t)count);
+    memcpy(buffer, &header, sizeof(header));
+
+    sched_serialize_context_t context = {
+        .records = (uint8_t*)buffer + sizeof(header),
+        .sampled_ns = dop_time_monotonic_ns()
+    };
+    atomic_init(&context.invalid, false);
+
+    if (dop_parallel_for(scheduler, components, count, 0, sched_serialize_range, &context) != DOP_SUCCESS ||
+        atomic_load(&context.invalid)) {
+        return 0;
+    }
+    return DOP_WIRE_STREAM_SIZE(count);
+}
+
+int dop_scheduler_worker_stats(const dop_scheduler_t* scheduler, uint32_t worker,
+                               dop_scheduler_worker_stats_t* stats) {
+    if (!scheduler || worker >= scheduler->worker_count || !stats) return DOP_ERROR_INVALID_PARAMETER;
+
+    stats->ranges = atomic_load_explicit(&scheduler->workers[worker].ranges, memory_order_relaxed);
+    stats->steals = atomic_load_explicit(&scheduler->workers[worker].steals, memory_order_relaxed);
+    return DOP_SUCCESS;
+}
@@ -0,0 +1,190 @@
+// src/dop_slab.c
+// OBINexus DOP Slab Allocator Implementation
+// Per-type component slabs with thread-local free lists
+
+#include "dop_slab.h"
+#include <stdlib.h>
+#include <stdatomic.h>
+
+// Free objects are linked through their own storage
+typedef struct dop_slab_node {
+    struct dop_slab_node* next;
+} dop_slab_node_t;
+
+typedef struct {
+    pthread_mutex_t mutex;
+    dop_slab_node_t* free_list;
+    atomic_size_t live;
+    atomic_size_t peak;
+    atomic_size_t capacity;
+} dop_slab_pool_t;
+
+typedef struct {
+    dop_slab_node_t* head[DOP_COMPONENT_COUNT];
+    uint32_t count[DOP_COMPONENT_COUNT];
+    bool registered;
+} dop_slab_cache_t;
+
+static dop_slab_pool_t g_pools[DOP_COMPONENT_COUNT];
+static pthread_once_t g_pools_once = PTHREAD_ONCE_INIT;
+static pthread_key_t g_cache_key;
+
+static _Thread_local dop_slab_cache_t t_cache;
+
+// Caller holds pool->mutex. Moves up to `count` objects onto the thread cache.
+static uint32_t slab_take(dop_slab_pool_t* pool, dop_slab_cache_t* cache, dop_component_type_t type, uint32_t count) {
+    uint32_t taken = 0;
+
+    while (taken < count) {
+        if (!pool->free_list) {
+            dop_component_t* slab = aligned_alloc(DOP_CACHE_LINE, DOP_SLAB_OBJECTS * sizeof(dop_component_t));
+            if (!slab) break;
+            for (uint32_t i = 0; i < DOP_SLAB_OBJECTS; i++) {
+                dop_slab_node_t* node = (dop_slab_node_t*)&slab[i];
+                node->next = pool->free_list;
+                pool->free_list = node;
+            }
+            atomic_fetch_add_explicit(&pool->capacity, DOP_SLAB_OBJECTS, memory_order_relaxed);
+        }
+
+        dop_slab_node_t* node = pool->free_list;
+        pool->free_list = node->next;
+        node->next = cache->head[type];
+        cache->head[type] = node;
+        taken++;
+    }
+
+    cache->count[type] += taken;
+    return taken;
+}
+
+// Caller holds pool->mutex. Returns up to `count` objects from the thread cache.
+static void slab_give(dop_slab_pool_t* pool, dop_slab_cache_t* cache, dop_component_type_t type, uint32_t count) {
+    while (count-- > 0 && cache->head[type]) {
+        dop_slab_node_t* node = cache->head[type];
+        cache->head[type] = node->next;
+        node->next = pool->free_list;
+        pool->free_list = node;
+        cache->count[type]--;
+    }
+}
+
+// Thread exit hands the cached objects back to the shared pools
+static void slab_cache_release(void* arg) {
+    dop_slab_cache_t* cache = arg;
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        if (!cache->head[type]) continue;
+        pthread_mutex_lock(&g_pools[type].mutex);
+        slab_give(&g_pools[type], cache, (dop_component_type_t)type, UINT32_MAX);
+        pthread_mutex_unlock(&g_pools[type].mutex);
+    }
+}
+
+static void slab_init_pools(void) {
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        pthread_mutex_init(&g_pools[type].mutex, NULL);
+        g_pools[type].free_list = NULL;
+        atomic_init(&g_pools[type].live, 0);
+        atomic_init(&g_pools[type].peak, 0);
+        atomic_init(&g_pools[type].capacity, 0);
+    }
+    pthread_key_create(&g_cache_key, slab_cache_release);
+}
+
+static dop_slab_cache_t* slab_cache(void) {
+    pthread_once(&g_pools_once, slab_init_pools);
+
+    dop_slab_cache_t* cache = &t_cache;
+    if (!cache->registered) {
+        pthread_setspecific(g_cache_key, cache);
+        cache->registered = true;
+    }
+    return cache;
+}
+
+static void slab_count_live(dop_slab_pool_t* pool, size_t added) {
+    size_t live = atomic_fetch_add_explicit(&pool->live, added, memory_order_relaxed) + added;
+    size_t peak = atomic_load_explicit(&pool->peak, memory_order_relaxed);
+    while (live > peak &&
+           !atomic_compare_exchange_weak_explicit(&pool->peak, &peak, live,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+// Raw object allocation
+dop_component_t* dop_slab_alloc(dop_component_type_t type) {
+    dop_component_t* component = NULL;
+    return dop_slab_alloc_batch(type, &component, 1) == 1 ? component : NULL;
+}
+
+void dop_slab_free(dop_component_t* component) {
+    if (component) dop_slab_free_batch(&component, 1);
+}
+
+size_t dop_slab_alloc_batch(dop_component_type_t type, dop_component_t** components, size_t count) {
+    if (type < 0 || type >= DOP_COMPONENT_COUNT || (!components && count > 0)) return 0;
+
+    dop_slab_cache_t* cache = slab_cache();
+    dop_slab_pool_t* pool = &g_pools[type];
+    size_t allocated = 0;
+
+    while (allocated < count) {
+        if (!cache->head[type]) {
+            size_t wanted = count - allocated;
+            uint32_t refill = wanted > DOP_SLAB_BATCH ? (uint32_t)wanted : DOP_SLAB_BATCH;
+            pthread_mutex_lock(&pool->mutex);
+            uint32_t taken = slab_take(pool, cache, type, refill);
+            pthread_mutex_unlock(&pool->mutex);
+            if (taken == 0) break;
+        }
+
+        dop_slab_node_t* node = cache->head[type];
+        cache->head[type] = node->next;
+        cache->count[type]--;
+        components[allocated++] = (dop_component_t*)node;
+    }
+
+    if (allocated > 0) slab_count_live(pool, allocated);
+    return allocated;
+}
+
+void dop_slab_free_batch(dop_component_t* const* components, size_t count) {
+    if (!components) return;
+
+    dop_slab_cache_t* cache = slab_cache();
+    size_t freed[DOP_COMPONENT_COUNT] = { 0 };
+
+    for (size_t i = 0; i < count; i++) {
+        dop_component_t* component = components[i];
+        if (!component) continue;
+
+        // Type is read before the node link overwrites the header
+        dop_component_type_t type = component->metadata.type;
+        dop_slab_node_t* node = (dop_slab_node_t*)component;
+        node->next = cache->head[type];
+        cache->head[type] = node;
+        freed[type]++;
+
+        if (++cache->count[type] > DOP_SLAB_CACHE_MAX) {
+            pthread_mutex_lock(&g_pools[type].mutex);
+            slab_give(&g_pools[type], cache, type, cache->count[type] - DOP_SLAB_BATCH);
+            pthread_mutex_unlock(&g_pools[type].mutex);
+        }
+    }
+
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        if (freed[type] > 0) {
+            atomic_fetch_sub_explicit(&g_pools[type].live, freed[type], memory_order_relaxed);
+        }
+    }
+}
+
+int dop_slab_get_stats(dop_component_type_t type, dop_slab_stats_t* stats) {
+    if (type < 0 || type >= DOP_COMPONENT_COUNT || !stats) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_once(&g_pools_once, slab_init_pools);
+    stats->live = atomic_load_explicit(&g_pools[type].live, memory_order_relaxed);
+    stats->peak = atomic_load_explicit(&g_pools[type].peak, memory_order_relaxed);
+    stats->capacity = atomic_load_explicit(&g_pools[type].capacity, memory_order_relaxed);
+    return DOP_SUCCESS;
+}
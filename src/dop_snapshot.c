@@ -0,0 +1,421 @@
+// src/dop_snapshot.c
+// OBINexus DOP Snapshot Implementation
+// Page-aligned shard images restored through a copy-on-write mapping
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dop_snapshot.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+typedef struct dop_snapshot_restore {
+    const uint32_t* checksums;                  // Rows of the mapping, one per shard
+    uint32_t shard_base[DOP_COMPONENT_COUNT];   // First row of each type
+    uint64_t rebase_ns;                         // Writer's monotonic base -> ours, modulo 2^64
+    _Atomic(uint64_t) failed;
+    uint32_t zone_count;
+    uint16_t zones[];                           // Writer's zone id - 1 -> id in this process
+} dop_snapshot_restore_t;
+
+static inline uint64_t snapshot_align(uint64_t size) {
+    return (size + DOP_SNAPSHOT_ALIGN - 1) & ~(uint64_t)(DOP_SNAPSHOT_ALIGN - 1);
+}
+
+static inline size_t snapshot_row(const dop_snapshot_restore_t* restore, const dop_store_shard_t* shard) {
+    return ((size_t)restore->shard_base[shard->type] + shard->index) * DOP_STORE_SHARD_CAPACITY;
+}
+
+// Shards are only ever appended, so pointers gathered under store->mutex
+// stay valid after it drops. counts, when given, receives the per-type totals.
+static dop_store_shard_t** snapshot_gather_shards(dop_component_store_t* store, uint32_t* counts, size_t* total) {
+    pthread_mutex_lock(&store->mutex);
+    *total = 0;
+    uint32_t shard_count[DOP_COMPONENT_COUNT];
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        shard_count[type] = atomic_load_explicit(&store->shard_count[type], memory_order_relaxed);
+        if (counts) counts[type] = shard_count[type];
+        *total += shard_count[type];
+    }
+    dop_store_shard_t** shards = malloc((*total > 0 ? *total : 1) * sizeof(dop_store_shard_t*));
+    if (shards) {
+        size_t count = 0;
+        for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+            for (uint32_t i = 0; i < shard_count[type]; i++) {
+                shards[count++] = store->shards[type][i];
+            }
+        }
+    }
+    pthread_mutex_unlock(&store->mutex);
+    return shards;
+}
+
+// Writing
+static int snapshot_pwrite(int fd, const void* data, size_t size, uint64_t offset) {
+    const uint8_t* cursor = data;
+    while (size > 0) {
+        ssize_t written = pwrite(fd, cursor, size, (off_t)offset);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return DOP_ERROR_INVALID_STATE;
+        }
+        cursor += written;
+        size -= (size_t)written;
+        offset += (uint64_t)written;
+    }
+    return DOP_SUCCESS;
+}
+
+// No store lock is held across the I/O: each shard is copied out under its
+// own lock, then scrubbed of process state and written from the copy
+static int snapshot_write_shards(dop_component_store_t* store, int fd, dop_snapshot_header_t* header) {
+    size_t total;
+    dop_store_shard_t** shards = snapshot_gather_shards(store, header->shard_count, &total);
+    if (!shards) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    header->shard_stride = snapshot_align(sizeof(dop_store_shard_t));
+    header->checksums_offset = DOP_SNAPSHOT_ALIGN;
+    header->shards_offset = snapshot_align(header->checksums_offset +
+                                           (uint64_t)total * DOP_STORE_SHARD_CAPACITY * sizeof(uint32_t));
+    header->zones_offset = header->shards_offset + (uint64_t)total * header->shard_stride;
+
+    dop_store_shard_t* image = aligned_alloc(DOP_SNAPSHOT_ALIGN, header->shard_stride);
+    uint32_t* checksums = malloc(DOP_STORE_SHARD_CAPACITY * sizeof(uint32_t));
+    if (!image || !checksums) {
+        free(shards);
+        free(image);
+        free(checksums);
+        return DOP_ERROR_MEMORY_ALLOCATION;
+    }
+    memset(image, 0, header->shard_stride);
+
+    int result = DOP_SUCCESS;
+    for (size_t row = 0; row < total && result == DOP_SUCCESS; row++) {
+        dop_store_lock_shard(shards[row]);
+        memcpy(image, shards[row], sizeof(dop_store_shard_t));
+        dop_store_unlock_shard(shards[row]);
+
+        memset(&image->mutex, 0, sizeof(image->mutex));
+        memset(image->views, 0, sizeof(image->views));
+        image->restore = NULL;
+
+        memset(checksums, 0, DOP_STORE_SHARD_CAPACITY * sizeof(uint32_t));
+        for (uint32_t slot = 0; slot < image->high_water; slot++) {
+            if (image->flags[slot] & DOP_SLOT_LIVE) {
+                checksums[slot] = dop_store_slot_checksum(image, slot);
+            }
+        }
+
+        result = snapshot_pwrite(fd, image, header->shard_stride,
+                                 header->shards_offset + (uint64_t)row * header->shard_stride);
+        if (result == DOP_SUCCESS) {
+            result = snapshot_pwrite(fd, checksums, DOP_STORE_SHARD_CAPACITY * sizeof(uint32_t),
+                                     header->checksums_offset +
+                                     (uint64_t)row * DOP_STORE_SHARD_CAPACITY * sizeof(uint32_t));
+        }
+    }
+
+    free(shards);
+    free(image);
+    free(checksums);
+    return result;
+}
+
+// Zone ids are dense from 1. Counted after the shards, so every id a
+// written clock refers to is covered.
+static int snapshot_write_zones(int fd, dop_snapshot_header_t* header) {
+    char name[DOP_TZ_NAME_MAX];
+    const char* loaded;
+
+    header->zone_count = 0;
+    while (header->zone_count < DOP_TZ_MAX_ZONES &&
+           (loaded = dop_tz_name((uint16_t)(header->zone_count + 1))) != NULL) {
+        memset(name, 0, sizeof(name));
+        strncpy(name, loaded, sizeof(name) - 1);
+        int result = snapshot_pwrite(fd, name, sizeof(name),
+                                     header->zones_offset + (uint64_t)header->zone_count * sizeof(name));
+        if (result != DOP_SUCCESS) return result;
+        header->zone_count++;
+    }
+
+    header->file_size = header->zones_offset + (uint64_t)header->zone_count * DOP_TZ_NAME_MAX;
+    return DOP_SUCCESS;
+}
+
+int dop_snapshot_write(dop_component_store_t* store, const char* path) {
+    if (!store || !path) return DOP_ERROR_INVALID_PARAMETER;
+
+    size_t path_length = strlen(path);
+    char* temporary = malloc(path_length + sizeof(".tmp"));
+    if (!temporary) return DOP_ERROR_MEMORY_ALLOCATION;
+    memcpy(temporary, path, path_length);
+    memcpy(temporary + path_length, ".tmp", sizeof(".tmp"));
+
+    int fd = open(temporary, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        free(temporary);
+        return DOP_ERROR_INVALID_STATE;
+    }
+
+    dop_snapshot_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = DOP_SNAPSHOT_MAGIC;
+    header.version = DOP_SNAPSHOT_VERSION;
+    header.checksum_algorithm = DOP_CHECKSUM_FIELDWISE;
+    header.shard_size = sizeof(dop_store_shard_t);
+    header.shard_capacity = DOP_STORE_SHARD_CAPACITY;
+    header.sampled_ns = dop_time_monotonic_ns();
+    header.sampled_ms = dop_time_realtime_ms();
+
+    int result = snapshot_write_shards(store, fd, &header);
+
+    if (result == DOP_SUCCESS) result = snapshot_write_zones(fd, &header);
+    if (result == DOP_SUCCESS) result = snapshot_pwrite(fd, &header, sizeof(header), 0);
+    if (result == DOP_SUCCESS && (ftruncate(fd, (off_t)header.file_size) != 0 || fsync(fd) != 0)) {
+        result = DOP_ERROR_INVALID_STATE;
+    }
+    if (close(fd) != 0 && result == DOP_SUCCESS) result = DOP_ERROR_INVALID_STATE;
+    if (result == DOP_SUCCESS && rename(temporary, path) != 0) result = DOP_ERROR_INVALID_STATE;
+
+    if (result != DOP_SUCCESS) unlink(temporary);
+    free(temporary);
+    return result;
+}
+
+// Restore
+static bool snapshot_header_valid(const dop_snapshot_header_t* header, size_t size) {
+    if (header->magic != DOP_SNAPSHOT_MAGIC || header->version != DOP_SNAPSHOT_VERSION ||
+        header->checksum_algorithm != DOP_CHECKSUM_FIELDWISE ||
+        header->shard_size != sizeof(dop_store_shard_t) ||
+        header->shard_capacity != DOP_STORE_SHARD_CAPACITY ||
+        header->shard_stride != snapshot_align(sizeof(dop_store_shard_t)) ||
+        header->file_size != size || header->zone_count > DOP_TZ_MAX_ZONES) {
+        return false;
+    }
+
+    uint64_t total = 0;
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        if (header->shard_count[type] > DOP_STORE_MAX_SHARDS) return false;
+        total += header->shard_count[type];
+    }
+
+    return header->checksums_offset >= sizeof(*header) &&
+           header->checksums_offset % sizeof(uint32_t) == 0 &&
+           header->checksums_offset + total * DOP_STORE_SHARD_CAPACITY * sizeof(uint32_t) <= header->shards_offset &&
+           header->shards_offset % DOP_SNAPSHOT_ALIGN == 0 &&
+           header->shards_offset + total * header->shard_stride <= header->zones_offset &&
+           header->zones_offset + (uint64_t)header->zone_count * DOP_TZ_NAME_MAX <= size;
+}
+
+// Reads only the shard's bookkeeping, never its columns
+static bool snapshot_shard_valid(const dop_store_shard_t* shard, dop_component_type_t type, uint32_t index) {
+    if (shard->type != type || shard->index != index ||
+        shard->high_water > DOP_STORE_SHARD_CAPACITY || shard->free_count > shard->high_water ||
+        shard->live_count > shard->high_water) {
+        return false;
+    }
+    for (uint32_t i = 0; i < shard->free_count; i++) {
+        if (shard->free_slots[i] >= shard->high_water) return false;
+    }
+    for (uint32_t slot = 0; slot < DOP_STORE_SHARD_CAPACITY; slot++) {
+        if (shard->views[slot]) return false;
+    }
+    return true;
+}
+
+int dop_snapshot_restore(const char* path, dop_component_store_t** store) {
+    if (!path || !store) return DOP_ERROR_INVALID_PARAMETER;
+    *store = NULL;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return DOP_ERROR_INVALID_STATE;
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(dop_snapshot_header_t)) {
+        close(fd);
+        return DOP_ERROR_INVALID_STATE;
+    }
+
+    // Private mapping: the store writes to its copy, never to the file
+    size_t size = (size_t)status.st_size;
+    uint8_t* base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return DOP_ERROR_INVALID_STATE;
+
+    const dop_snapshot_header_t* header = (const dop_snapshot_header_t*)base;
+    bool valid = snapshot_header_valid(header, size);
+    uint64_t row = 0;
+    for (int type = 0; valid && type < DOP_COMPONENT_COUNT; type++) {
+        for (uint32_t i = 0; valid && i < header->shard_count[type]; i++, row++) {
+            valid = snapshot_shard_valid((const dop_store_shard_t*)(base + header->shards_offset +
+                                                                   row * header->shard_stride),
+                                         (dop_component_type_t)type, i);
+        }
+    }
+
+    dop_component_store_t* restored = valid ? dop_store_create() : NULL;
+    dop_snapshot_restore_t* restore = restored ?
+        calloc(1, sizeof(dop_snapshot_restore_t) + header->zone_count * sizeof(uint16_t)) : NULL;
+    if (!restore) {
+        dop_store_destroy(restored);
+        munmap(base, size);
+        return valid ? DOP_ERROR_MEMORY_ALLOCATION : DOP_ERROR_INVALID_STATE;
+    }
+
+    // Rebase so spans keep running across the downtime measured on the
+    // wall clock, whichever boot the writer's monotonic clock belonged to
+    uint64_t now_ns = dop_time_monotonic_ns();
+    uint64_t now_ms = dop_time_realtime_ms();
+    uint64_t downtime_ns = now_ms > header->sampled_ms ? (now_ms - header->sampled_ms) * DOP_NS_PER_MS : 0;
+    restore->rebase_ns = now_ns - downtime_ns - header->sampled_ns;
+    restore->checksums = (const uint32_t*)(base + header->checksums_offset);
+
+    // Zone ids are process-local; rebind by name, keeping the last offset
+    // as a fixed one for zones this host does not have
+    const char* names = (const char*)(base + header->zones_offset);
+    restore->zone_count = header->zone_count;
+    for (uint32_t z = 0; z < header->zone_count; z++) {
+        const char* name = names + (size_t)z * DOP_TZ_NAME_MAX;
+        uint16_t zone;
+        bool terminated = memchr(name, '\0', DOP_TZ_NAME_MAX) != NULL;
+        restore->zones[z] = terminated && dop_tz_load(name, &zone) == DOP_SUCCESS ? zone : DOP_TZ_FIXED;
+    }
+
+    row = 0;
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        restore->shard_base[type] = (uint32_t)row;
+        for (uint32_t i = 0; i < header->shard_count[type]; i++, row++) {
+            dop_store_shard_t* shard = (dop_store_shard_t*)(base + header->shards_offset + row * header->shard_stride);
+            pthread_mutex_init(&shard->mutex, NULL);
+            shard->restore = restore;
+            restored->shards[type][i] = shard;
+        }
+        atomic_store_explicit(&restored->shard_count[type], header->shard_count[type], memory_order_release);
+    }
+
+    restored->snapshot_base = base;
+    restored->snapshot_size = size;
+    restored->snapshot = restore;
+    *store = restored;
+    return DOP_SUCCESS;
+}
+
+// Settling
+void dop_snapshot_settle_shard(dop_store_shard_t* shard) {
+    dop_snapshot_restore_t* restore = shard ? shard->restore : NULL;
+    if (!restore) return;
+
+    const uint32_t* checksums = restore->checksums + snapshot_row(restore, shard);
+    uint64_t failed = 0;
+
+    for (uint32_t slot = 0; slot < shard->high_water; slot++) {
+        uint32_t flags = shard->flags[slot];
+        if (!(flags & DOP_SLOT_LIVE)) continue;
+
+        // Checked before any fix-up: the checksum covers the written bytes
+        if (dop_store_slot_checksum(shard, slot) != checksums[slot]) {
+            shard->gate[slot] = DOP_GATE_ISOLATED;
+            shard->state[slot] = DOP_STATE_ERROR;
+            failed++;
+            continue;
+        }
+
+        switch (shard->type) {
+            case DOP_COMPONENT_CLOCK: {
+                uint16_t zone = (uint16_t)(flags >> DOP_SLOT_ZONE_SHIFT);
+                if (zone != DOP_TZ_LOCAL && zone != DOP_TZ_FIXED) {
+                    uint16_t rebound = zone <= restore->zone_count ? restore->zones[zone - 1] : DOP_TZ_FIXED;
+                    shard->flags[slot] = (flags & ~((uint32_t)0xFFFFu << DOP_SLOT_ZONE_SHIFT)) |
+                                         ((uint32_t)rebound << DOP_SLOT_ZONE_SHIFT);
+                }
+                break;
+            }
+            case DOP_COMPONENT_STOPWATCH:
+                if ((flags & (DOP_SLOT_RUNNING | DOP_SLOT_PAUSED)) == DOP_SLOT_RUNNING) {
+                    shard->start_ns[slot] += restore->rebase_ns;
+                }
+                break;
+            case DOP_COMPONENT_TIMER:
+                if (flags & DOP_SLOT_RUNNING) {
+                    shard->start_ns[slot] += restore->rebase_ns;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (failed > 0) {
+        atomic_fetch_add_explicit(&restore->failed, failed, memory_order_relaxed);
+    }
+    shard->restore = NULL;
+}
+
+typedef struct {
+    dop_store_shard_t** shards;
+    size_t count;
+    _Atomic(size_t) next;
+} snapshot_verify_job_t;
+
+// Workers claim shards one at a time; taking the lock settles the shard
+static void* snapshot_verify_worker(void* context) {
+    snapshot_verify_job_t* job = context;
+    for (;;) {
+        size_t i = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed);
+        if (i >= job->count) break;
+        dop_store_lock_shard(job->shards[i]);
+        dop_store_unlock_shard(job->shards[i]);
+    }
+    return NULL;
+}
+
+int dop_snapshot_verify(dop_component_store_t* store, uint32_t worker_count, size_t* failed) {
+    if (!store) return DOP_ERROR_INVALID_PARAMETER;
+    if (failed) *failed = 0;
+    if (!store->snapshot) return DOP_SUCCESS;
+
+    snapshot_verify_job_t job = { .count = 0 };
+    job.shards = snapshot_gather_shards(store, NULL, &job.count);
+    if (!job.shards) return DOP_ERROR_MEMORY_ALLOCATION;
+
+    if (worker_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = online > 0 ? (uint32_t)online : 1;
+    }
+    if (worker_count > job.count) worker_count = job.count > 0 ? (uint32_t)job.count : 1;
+
+    // The calling thread is worker 0
+    pthread_t* threads = worker_count > 1 ? malloc((worker_count - 1) * sizeof(pthread_t)) : NULL;
+    uint32_t started = 0;
+    while (threads && started < worker_count - 1 &&
+           pthread_create(&threads[started], NULL, snapshot_verify_worker, &job) == 0) {
+        started++;
+    }
+    snapshot_verify_worker(&job);
+    for (uint32_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+    free(job.shards);
+
+    uint64_t failures = atomic_load_explicit(&store->snapshot->failed, memory_order_relaxed);
+    if (failed) *failed = (size_t)failures;
+    return failures > 0 ? DOP_ERROR_CHECKSUM_FAILED : DOP_SUCCESS;
+}
+
+void dop_snapshot_release(dop_component_store_t* store) {
+    if (!store || !store->snapshot_base) return;
+
+    munmap(store->snapshot_base, store->snapshot_size);
+    free(store->snapshot);
+    store->snapshot_base = NULL;
+    store->snapshot_size = 0;
+    store->snapshot = NULL;
+}
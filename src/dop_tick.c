@@ -0,0 +1,396 @@
+// src/dop_tick.c
+// OBINexus DOP Tick Engine Implementation
+// Per-core component shards driven by pinned worker threads
+
+#define _GNU_SOURCE
+
+#include "dop_tick.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+#define TICK_INITIAL_CAPACITY 64u
+#define TICK_NS_PER_SECOND    1000000000ull
+
+typedef enum {
+    TICK_STOPPED = 0,
+    TICK_RUNNING,
+    TICK_DRAINING,
+    TICK_STOPPING
+} dop_tick_state_t;
+
+typedef struct {
+    _Alignas(DOP_CACHE_LINE) pthread_mutex_t mutex;    // Guards components; held for a pass
+    dop_component_t** components;
+    size_t count;
+    size_t capacity;
+    pthread_t thread;
+    uint32_t index;
+    int cpu;
+    _Atomic(uint64_t) ticks;
+    _Atomic(uint64_t) missed_ticks;
+    struct dop_tick_engine* engine;
+} dop_tick_shard_t;
+
+struct dop_tick_engine {
+    pthread_mutex_t state_mutex;    // Guards transitions; workers sleep on state_cond
+    pthread_cond_t state_cond;      // Timed waits use CLOCK_MONOTONIC
+    _Atomic(int) state;
+    _Atomic(uint64_t) period_ns;
+    dop_component_store_t* store;
+    dop_build_topology_t* topology;
+    uint32_t shard_count;
+    dop_tick_shard_t* shards;
+};
+
+static inline bool tick_stopping(const dop_tick_engine_t* engine) {
+    return atomic_load_explicit(&engine->state, memory_order_relaxed) == TICK_STOPPING;
+}
+
+static void tick_pass(dop_tick_shard_t* shard) {
+    dop_tick_engine_t* engine = shard->engine;
+
+    pthread_mutex_lock(&shard->mutex);
+    for (size_t i = 0; i < shard->count && !tick_stopping(engine); i++) {
+        dop_func_update_component(shard->components[i]);
+    }
+    pthread_mutex_unlock(&shard->mutex);
+
+    dop_component_store_t* store = engine->store;
+    if (store) {
+        uint64_t now_ms = dop_time_realtime_ms();
+        for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+            uint32_t store_shards = dop_store_shard_count(store, (dop_component_type_t)type);
+            for (uint32_t i = shard->index; i < store_shards && !tick_stopping(engine);
+                 i += engine->shard_count) {
+                dop_store_shard_t* store_shard = store->shards[type][i];
+                dop_store_lock_shard(store_shard);
+                dop_store_update_shard(store_shard, now_ms, NULL);
+                dop_store_unlock_shard(store_shard);
+            }
+        }
+    }
+
+    atomic_fetch_add_explicit(&shard->ticks, 1, memory_order_relaxed);
+}
+
+static void* tick_worker(void* arg) {
+    dop_tick_shard_t* shard = arg;
+    dop_tick_engine_t* engine = shard->engine;
+
+    uint64_t deadline_ns = dop_time_monotonic_ns();
+    for (;;) {
+        int state = atomic_load_explicit(&engine->state, memory_order_acquire);
+        if (state == TICK_STOPPING) break;
+
+        tick_pass(shard);
+        if (state == TICK_DRAINING) break;
+
+        // Absolute deadlines: late passes skip whole periods rather than burst
+        uint64_t period_ns = atomic_load_explicit(&engine->period_ns, memory_order_relaxed);
+        deadline_ns += period_ns;
+        uint64_t now_ns = dop_time_monotonic_ns();
+        if (now_ns > deadline_ns) {
+            uint64_t skipped = (now_ns - deadline_ns) / period_ns;
+            deadline_ns += skipped * period_ns;
+            atomic_fetch_add_explicit(&shard->missed_ticks, skipped, memory_order_relaxed);
+        }
+
+        struct timespec wake = {
+            .tv_sec = (time_t)(deadline_ns / TICK_NS_PER_SECOND),
+            .tv_nsec = (long)(deadline_ns % TICK_NS_PER_SECOND)
+        };
+        pthread_mutex_lock(&engine->state_mutex);
+        while (atomic_load_explicit(&engine->state, memory_order_relaxed) == TICK_RUNNING &&
+               dop_time_monotonic_ns() < deadline_ns) {
+            pthread_cond_timedwait(&engine->state_cond, &engine->state_mutex, &wake);
+        }
+        pthread_mutex_unlock(&engine->state_mutex);
+    }
+
+    return NULL;
+}
+
+// Maps shard i onto the i-th CPU this process may run on; -1 if there are
+// more shards than CPUs
+static int tick_shard_cpu(uint32_t index, uint32_t shard_count) {
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return -1;
+    if (shard_count > (uint32_t)CPU_COUNT(&allowed)) return -1;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &allowed) && index-- == 0) return cpu;
+    }
+    return -1;
+}
+
+// Engine Lifecycle
+dop_tick_engine_t* dop_tick_engine_create(uint32_t shard_count, uint32_t tick_hz) {
+    if (tick_hz > DOP_TICK_MAX_HZ) return NULL;
+    if (shard_count == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        shard_count = online > 0 ? (uint32_t)online : 1;
+    }
+
+    dop_tick_engine_t* engine = calloc(1, sizeof(dop_tick_engine_t));
+    if (!engine) return NULL;
+
+    engine->shards = aligned_alloc(DOP_CACHE_LINE, shard_count * sizeof(dop_tick_shard_t));
+    if (!engine->shards) {
+        free(engine);
+        return NULL;
+    }
+    memset(engine->shards, 0, shard_count * sizeof(dop_tick_shard_t));
+    engine->shard_count = shard_count;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&engine->state_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&engine->state_mutex, NULL);
+    atomic_init(&engine->state, TICK_STOPPED);
+    atomic_init(&engine->period_ns, TICK_NS_PER_SECOND / (tick_hz ? tick_hz : DOP_TICK_DEFAULT_HZ));
+
+    for (uint32_t i = 0; i < shard_count; i++) {
+        dop_tick_shard_t* shard = &engine->shards[i];
+        pthread_mutex_init(&shard->mutex, NULL);
+        shard->index = i;
+        shard->cpu = tick_shard_cpu(i, shard_count);
+        shard->engine = engine;
+        atomic_init(&shard->ticks, 0);
+        atomic_init(&shard->missed_ticks, 0);
+    }
+
+    return engine;
+}
+
+void dop_tick_engine_destroy(dop_tick_engine_t* engine) {
+    if (!engine) return;
+
+    dop_tick_engine_stop(engine);
+    for (uint32_t i = 0; i < engine->shard_count; i++) {
+        pthread_mutex_destroy(&engine->shards[i].mutex);
+        free(engine->shards[i].components);
+    }
+    pthread_cond_destroy(&engine->state_cond);
+    pthread_mutex_destroy(&engine->state_mutex);
+    free(engine->shards);
+    free(engine);
+}
+
+uint32_t dop_tick_engine_shard_count(const dop_tick_engine_t* engine) {
+    return engine ? engine->shard_count : 0;
+}
+
+// Placement
+int dop_tick_engine_add_to_shard(dop_tick_engine_t* engine, dop_component_t* component, uint32_t shard) {
+    if (!engine || !component || shard >= engine->shard_count) return DOP_ERROR_INVALID_PARAMETER;
+
+    dop_tick_shard_t* target = &engine->shards[shard];
+    pthread_mutex_lock(&target->mutex);
+
+    if (target->count == target->capacity) {
+        size_t capacity = target->capacity ? target->capacity * 2 : TICK_INITIAL_CAPACITY;
+        dop_component_t** components = realloc(target->components, capacity * sizeof(dop_component_t*));
+        if (!components) {
+            pthread_mutex_unlock(&target->mutex);
+            return DOP_ERROR_MEMORY_ALLOCATION;
+        }
+        target->components = components;
+        target->capacity = capacity;
+    }
+    target->components[target->count++] = component;
+
+    pthread_mutex_unlock(&target->mutex);
+    return DOP_SUCCESS;
+}
+
+int dop_tick_engine_add(dop_tick_engine_t* engine, dop_component_t* component, uint32_t* shard) {
+    if (!engine || !component) return DOP_ERROR_INVALID_PARAMETER;
+
+    uint32_t lightest = 0;
+    size_t lightest_count = SIZE_MAX;
+    for (uint32_t i = 0; i < engine->shard_count; i++) {
+        pthread_mutex_lock(&engine->shards[i].mutex);
+        size_t count = engine->shards[i].count;
+        pthread_mutex_unlock(&engine->shards[i].mutex);
+        if (count < lightest_count) {
+            lightest = i;
+            lightest_count = count;
+        }
+    }
+
+    int result = dop_tick_engine_add_to_shard(engine, component, lightest);
+    if (result == DOP_SUCCESS && shard) *shard = lightest;
+    return result;
+}
+
+int dop_tick_engine_remove(dop_tick_engine_t* engine, dop_component_t* component) {
+    if (!engine || !component) return DOP_ERROR_INVALID_PARAMETER;
+
+    for (uint32_t i = 0; i < engine->shard_count; i++) {
+        dop_tick_shard_t* shard = &engine->shards[i];
+        pthread_mutex_lock(&shard->mutex);
+        for (size_t j = 0; j < shard->count; j++) {
+            if (shard->components[j] == component) {
+                shard->components[j] = shard->components[--shard->count];
+                pthread_mutex_unlock(&shard->mutex);
+                return DOP_SUCCESS;
+            }
+        }
+        pthread_mutex_unlock(&shard->mutex);
+    }
+
+    return DOP_ERROR_INVALID_PARAMETER;
+}
+
+int dop_tick_engine_attach_store(dop_tick_engine_t* engine, dop_component_store_t* store) {
+    if (!engine) return DOP_ERROR_INVALID_PARAMETER;
+    if (dop_tick_engine_is_running(engine)) return DOP_ERROR_INVALID_STATE;
+
+    engine->store = store;
+    return DOP_SUCCESS;
+}
+
+// Caller holds state_mutex
+static void tick_bind_topology_threads(dop_tick_engine_t* engine) {
+    dop_build_topology_t* topology = engine->topology;
+    if (!topology) return;
+
+    for (uint32_t i = 0; i < topology->node_count; i++) {
+        if (topology->nodes[i]) {
+            topology->nodes[i]->worker_thread = engine->shards[i % engine->shard_count].thread;
+        }
+    }
+}
+
+int dop_tick_engine_attach_topology(dop_tick_engine_t* engine, dop_build_topology_t* topology) {
+    if (!engine || !topology) return DOP_ERROR_INVALID_PARAMETER;
+
+    for (uint32_t i = 0; i < topology->node_count; i++) {
+        dop_topology_node_t* node = topology->nodes[i];
+        if (!node || !node->component) continue;
+
+        int result = dop_tick_engine_add_to_shard(engine, node->component, i % engine->shard_count);
+        if (result != DOP_SUCCESS) return result;
+    }
+
+    pthread_mutex_lock(&engine->state_mutex);
+    engine->topology = topology;
+    if (atomic_load_explicit(&engine->state, memory_order_relaxed) != TICK_STOPPED) {
+        tick_bind_topology_threads(engine);
+    }
+    pthread_mutex_unlock(&engine->state_mutex);
+    return DOP_SUCCESS;
+}
+
+// Starts the shard's worker pinned to its CPU, falling back to an unpinned
+// worker if the CPU cannot be used
+static int tick_spawn(dop_tick_shard_t* shard) {
+    if (shard->cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(shard->cpu, &cpus);
+
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        int result = pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+        if (result == 0) {
+            result = pthread_create(&shard->thread, &attr, tick_worker, shard);
+        }
+        pthread_attr_destroy(&attr);
+        if (result == 0) return 0;
+        shard->cpu = -1;
+    }
+
+    return pthread_create(&shard->thread, NULL, tick_worker, shard);
+}
+
+// Control
+// Moves a running engine to `state` and joins its workers
+static int tick_halt(dop_tick_engine_t* engine, dop_tick_state_t state) {
+    if (!engine) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&engine->state_mutex);
+    if (atomic_load_explicit(&engine->state, memory_order_relaxed) != TICK_RUNNING) {
+        pthread_mutex_unlock(&engine->state_mutex);
+        return DOP_SUCCESS;
+    }
+    atomic_store_explicit(&engine->state, state, memory_order_release);
+    pthread_cond_broadcast(&engine->state_cond);
+    pthread_mutex_unlock(&engine->state_mutex);
+
+    for (uint32_t i = 0; i < engine->shard_count; i++) {
+        pthread_join(engine->shards[i].thread, NULL);
+    }
+
+    atomic_store_explicit(&engine->state, TICK_STOPPED, memory_order_release);
+    return DOP_SUCCESS;
+}
+
+int dop_tick_engine_start(dop_tick_engine_t* engine) {
+    if (!engine) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&engine->state_mutex);
+    if (atomic_load_explicit(&engine->state, memory_order_relaxed) != TICK_STOPPED) {
+        pthread_mutex_unlock(&engine->state_mutex);
+        return DOP_ERROR_INVALID_STATE;
+    }
+    atomic_store_explicit(&engine->state, TICK_RUNNING, memory_order_release);
+
+    for (uint32_t i = 0; i < engine->shard_count; i++) {
+        if (tick_spawn(&engine->shards[i]) != 0) {
+            // Unwind the workers already started
+            atomic_store_explicit(&engine->state, TICK_STOPPING, memory_order_release);
+            pthread_cond_broadcast(&engine->state_cond);
+            pthread_mutex_unlock(&engine->state_mutex);
+            for (uint32_t j = 0; j < i; j++) {
+                pthread_join(engine->shards[j].thread, NULL);
+            }
+            atomic_store_explicit(&engine->state, TICK_STOPPED, memory_order_release);
+            return DOP_ERROR_INVALID_STATE;
+        }
+    }
+
+    tick_bind_topology_threads(engine);
+    pthread_mutex_unlock(&engine->state_mutex);
+    return DOP_SUCCESS;
+}
+
+int dop_tick_engine_stop(dop_tick_engine_t* engine) {
+    return tick_halt(engine, TICK_STOPPING);
+}
+
+int dop_tick_engine_drain(dop_tick_engine_t* engine) {
+    return tick_halt(engine, TICK_DRAINING);
+}
+
+int dop_tick_engine_set_rate(dop_tick_engine_t* engine, uint32_t tick_hz) {
+    if (!engine || tick_hz == 0 || tick_hz > DOP_TICK_MAX_HZ) return DOP_ERROR_INVALID_PARAMETER;
+
+    // Takes effect from each worker's next deadline
+    atomic_store_explicit(&engine->period_ns, TICK_NS_PER_SECOND / tick_hz, memory_order_relaxed);
+    return DOP_SUCCESS;
+}
+
+bool dop_tick_engine_is_running(const dop_tick_engine_t* engine) {
+    return engine && atomic_load_explicit(&engine->state, memory_order_acquire) != TICK_STOPPED;
+}
+
+int dop_tick_engine_shard_stats(const dop_tick_engine_t* engine, uint32_t shard, dop_tick_shard_stats_t* stats) {
+    if (!engine || shard >= engine->shard_count || !stats) return DOP_ERROR_INVALID_PARAMETER;
+
+    dop_tick_shard_t* source = &engine->shards[shard];
+    pthread_mutex_lock(&source->mutex);
+    stats->component_count = source->count;
+    pthread_mutex_unlock(&source->mutex);
+    stats->ticks = atomic_load_explicit(&source->ticks, memory_order_relaxed);
+    stats->missed_ticks = atomic_load_explicit(&source->missed_ticks, memory_order_relaxed);
+    stats->cpu = source->cpu;
+    return DOP_SUCCESS;
+}
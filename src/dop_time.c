@@ -0,0 +1,222 @@
+// src/dop_time.c
+// OBINexus DOP Time Source Implementation
+// vDSO clock reads with per-thread cached calendar decomposition
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE // struct tm::tm_gmtoff
+
+#include "dop_time.h"
+#include <stdatomic.h>
+
+// Per-thread UTC offset for one 15-minute epoch window. Zone transitions
+// fall on quarter-hour boundaries, so a window holds at most one offset
+// change; the cache keeps the second it happens at and the offset after it,
+// and local fields reduce to arithmetic even inside a transition window.
+#define TIME_WINDOW_SECONDS 900
+
+typedef struct {
+    int64_t window;
+    uint32_t tz_generation;
+    int64_t utc_offset;
+    int64_t transition;         // First second on after_offset; past the window if none
+    int64_t after_offset;
+} dop_time_cache_t;
+
+static _Thread_local dop_time_cache_t t_time_cache = { .window = -1 };
+static atomic_uint g_tz_generation = 1;
+
+static inline uint64_t time_read_ms(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+uint64_t dop_time_realtime_ms(void) {
+    return time_read_ms(CLOCK_REALTIME);
+}
+
+uint64_t dop_time_monotonic_ms(void) {
+    return time_read_ms(CLOCK_MONOTONIC);
+}
+
+uint64_t dop_time_monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void dop_time_tz_changed(void) {
+    tzset();
+    atomic_fetch_add_explicit(&g_tz_generation, 1, memory_order_release);
+}
+
+static int64_t time_gmtoff(int64_t epoch_second) {
+    time_t seconds = (time_t)epoch_second;
+    struct tm tm_info;
+    localtime_r(&seconds, &tm_info);
+    return tm_info.tm_gmtoff;
+}
+
+static inline int64_t time_cached_offset(const dop_time_cache_t* cache, int64_t epoch_second) {
+    return epoch_second >= cache->transition ? cache->after_offset : cache->utc_offset;
+}
+
+// Fills the calling thread's cache for the window holding epoch_second
+static const dop_time_cache_t* time_window_cache(int64_t epoch_second) {
+    int64_t window = epoch_second / TIME_WINDOW_SECONDS;
+    uint32_t generation = atomic_load_explicit(&g_tz_generation, memory_order_acquire);
+    dop_time_cache_t* cache = &t_time_cache;
+
+    if (cache->window != window || cache->tz_generation != generation) {
+        int64_t first = window * TIME_WINDOW_SECONDS;
+        int64_t last = first + TIME_WINDOW_SECONDS - 1;
+
+        cache->window = window;
+        cache->tz_generation = generation;
+        cache->utc_offset = time_gmtoff(first);
+        cache->after_offset = time_gmtoff(last);
+        cache->transition = last + 1;
+
+        // Window straddles a transition: bisect for the second it happens at
+        if (cache->after_offset != cache->utc_offset) {
+            int64_t before = first;
+            int64_t after = last;
+            while (after - before > 1) {
+                int64_t middle = before + (after - before) / 2;
+                if (time_gmtoff(middle) == cache->utc_offset) {
+                    before = middle;
+                } else {
+                    after = middle;
+                }
+            }
+            cache->transition = after;
+        }
+    }
+
+    return cache;
+}
+
+// Local UTC offset in seconds for an epoch second
+static int64_t time_local_offset(int64_t epoch_second) {
+    return time_cached_offset(time_window_cache(epoch_second), epoch_second);
+}
+
+// Local second of day for an epoch second
+static uint32_t time_local_second_of_day(int64_t epoch_second) {
+    int64_t second_of_day = (epoch_second + time_local_offset(epoch_second)) % 86400;
+    if (second_of_day < 0) second_of_day += 86400;
+    return (uint32_t)second_of_day;
+}
+
+// Packed Time Accessors
+dop_time_t dop_time_now(void) {
+    return dop_time_realtime_ms();
+}
+
+uint32_t dop_time_second_of_day(dop_time_t time) {
+    return time_local_second_of_day((int64_t)(time / 1000));
+}
+
+int32_t dop_time_utc_offset(dop_time_t time) {
+    return (int32_t)time_local_offset((int64_t)(time / 1000));
+}
+
+uint32_t dop_time_weekday(dop_time_t time) {
+    int64_t epoch_second = (int64_t)(time / 1000);
+    int64_t local_day = (epoch_second + time_local_offset(epoch_second)) / 86400;
+    // 1970-01-01 was a Thursday
+    return (uint32_t)((local_day + 4) % 7);
+}
+
+uint32_t dop_time_hours(dop_time_t time) {
+    return dop_time_second_of_day(time) / 3600;
+}
+
+uint32_t dop_time_minutes(dop_time_t time) {
+    return (dop_time_second_of_day(time) / 60) % 60;
+}
+
+uint32_t dop_time_seconds(dop_time_t time) {
+    return dop_time_second_of_day(time) % 60;
+}
+
+uint32_t dop_time_milliseconds(dop_time_t time) {
+    return (uint32_t)(time % 1000);
+}
+
+static inline dop_time_data_t time_data_at(dop_time_t time, int64_t utc_offset) {
+    int64_t second_of_day = ((int64_t)(time / 1000) + utc_offset) % 86400;
+    if (second_of_day < 0) second_of_day += 86400;
+
+    dop_time_data_t time_data = {
+        .timestamp_ms = time,
+        .hours = (uint32_t)second_of_day / 3600,
+        .minutes = ((uint32_t)second_of_day / 60) % 60,
+        .seconds = (uint32_t)second_of_day % 60,
+        .milliseconds = (uint32_t)(time % 1000),
+        .is_valid = true
+    };
+
+    return time_data;
+}
+
+dop_time_data_t dop_time_to_data(dop_time_t time) {
+    return time_data_at(time, time_local_offset((int64_t)(time / 1000)));
+}
+
+// Honors edited calendar fields: the timestamp is moved within its local
+// day so that it decomposes to the given H:M:S.ms
+dop_time_t dop_time_from_data(dop_time_data_t data) {
+    if (!data.is_valid || data.hours > 23 || data.minutes > 59 ||
+        data.seconds > 59 || data.milliseconds > 999) {
+        return data.timestamp_ms;
+    }
+
+    int64_t actual_ms = (int64_t)dop_time_second_of_day(data.timestamp_ms) * 1000 +
+                        (int64_t)(data.timestamp_ms % 1000);
+    int64_t wanted_ms = ((int64_t)data.hours * 3600 + data.minutes * 60 + data.seconds) * 1000 +
+                        data.milliseconds;
+    int64_t adjusted = (int64_t)data.timestamp_ms + (wanted_ms - actual_ms);
+
+    return adjusted > 0 ? (dop_time_t)adjusted : 0;
+}
+
+void dop_time_decompose_batch(const dop_time_t* times, size_t count, dop_time_data_t* out) {
+    if (!times || !out) return;
+
+    // Consecutive timestamps in one window share a single cache lookup,
+    // transition windows included
+    dop_time_cache_t window = { .window = -1 };
+    for (size_t i = 0; i < count; i++) {
+        int64_t epoch_second = (int64_t)(times[i] / 1000);
+        if (epoch_second / TIME_WINDOW_SECONDS != window.window) {
+            window = *time_window_cache(epoch_second);
+        }
+        out[i] = time_data_at(times[i], time_cached_offset(&window, epoch_second));
+    }
+}
+
+// Time Utilities Implementation
+dop_time_data_t dop_time_from_ms(uint64_t timestamp_ms) {
+    return dop_time_to_data(timestamp_ms);
+}
+
+dop_time_data_t dop_time_get_current(void) {
+    return dop_time_to_data(dop_time_realtime_ms());
+}
+
+dop_time_data_t dop_time_add_duration(dop_time_data_t base, uint64_t duration_ms) {
+    return dop_time_from_ms(base.timestamp_ms + duration_ms);
+}
+
+bool dop_time_is_equal(dop_time_data_t time1, dop_time_data_t time2) {
+    return time1.is_valid && time2.is_valid &&
+           time1.hours == time2.hours &&
+           time1.minutes == time2.minutes &&
+           time1.seconds == time2.seconds;
+}
+
+uint64_t dop_time_diff_ms(dop_time_data_t time1, dop_time_data_t time2) {
+    return time1.timestamp_ms >= time2.timestamp_ms ?
+           time1.timestamp_ms - time2.timestamp_ms : 0;
+}
@@ -0,0 +1,510 @@
+// src/dop_timing_wheel.c
+// OBINexus DOP Timing Wheel Implementation
+// Hierarchical wheel driving timer expiry and alarm triggering
+
+#include "dop_timing_wheel.h"
+#include "dop_time.h"
+#include <stdlib.h>
+#include <stddef.h>
+
+#define WHEEL_MS_PER_SECOND  1000ull
+#define WHEEL_MS_PER_MINUTE  60000ull
+#define WHEEL_MS_PER_HOUR    3600000ull
+
+// Bucket indices: level0 [0,1000), level1 [1000,1060), level2 [1060,1120),
+// level3 [1120,1144), overflow 1144, due 1145
+#define WHEEL_BUCKET_L1        1000u
+#define WHEEL_BUCKET_L2        1060u
+#define WHEEL_BUCKET_L3        1120u
+#define WHEEL_BUCKET_OVERFLOW  1144u
+#define WHEEL_BUCKET_DUE       1145u
+
+static dop_timing_wheel_t* g_default_wheel = NULL;
+static pthread_once_t g_default_wheel_once = PTHREAD_ONCE_INIT;
+
+static inline dop_component_t* wheel_owner(dop_wheel_entry_t* entry) {
+    return (dop_component_t*)((char*)entry - offsetof(dop_component_t, wheel_entry));
+}
+
+static dop_wheel_bucket_t* wheel_bucket(dop_timing_wheel_t* wheel, uint32_t bucket) {
+    if (bucket < WHEEL_BUCKET_L1) return &wheel->level0[bucket];
+    if (bucket < WHEEL_BUCKET_L2) return &wheel->level1[bucket - WHEEL_BUCKET_L1];
+    if (bucket < WHEEL_BUCKET_L3) return &wheel->level2[bucket - WHEEL_BUCKET_L2];
+    if (bucket < WHEEL_BUCKET_OVERFLOW) return &wheel->level3[bucket - WHEEL_BUCKET_L3];
+    if (bucket == WHEEL_BUCKET_OVERFLOW) return &wheel->overflow;
+    return &wheel->due;
+}
+
+static int wheel_bucket_level(uint32_t bucket) {
+    if (bucket < WHEEL_BUCKET_L1) return 0;
+    if (bucket < WHEEL_BUCKET_L2) return 1;
+    if (bucket < WHEEL_BUCKET_L3) return 2;
+    if (bucket < WHEEL_BUCKET_OVERFLOW) return 3;
+    return -1;
+}
+
+static void wheel_bucket_init(dop_wheel_bucket_t* bucket) {
+    bucket->head.next = &bucket->head;
+    bucket->head.prev = &bucket->head;
+}
+
+static inline bool wheel_bucket_empty(const dop_wheel_bucket_t* bucket) {
+    return bucket->head.next == &bucket->head;
+}
+
+// Occupancy bit of a level bucket: level0 fills words 0-15, levels 1-3 one word each
+static inline uint64_t* wheel_occupancy(dop_timing_wheel_t* wheel, uint32_t bucket, uint64_t* bit) {
+    uint32_t word;
+    uint32_t offset;
+    if (bucket < WHEEL_BUCKET_L1) {
+        word = bucket / 64;
+        offset = bucket % 64;
+    } else if (bucket < WHEEL_BUCKET_L2) {
+        word = 16;
+        offset = bucket - WHEEL_BUCKET_L1;
+    } else if (bucket < WHEEL_BUCKET_L3) {
+        word = 17;
+        offset = bucket - WHEEL_BUCKET_L2;
+    } else {
+        word = 18;
+        offset = bucket - WHEEL_BUCKET_L3;
+    }
+    *bit = 1ull << offset;
+    return &wheel->occupied[word];
+}
+
+static void wheel_unlink(dop_timing_wheel_t* wheel, dop_wheel_entry_t* entry) {
+    int level = wheel_bucket_level(entry->bucket);
+    if (level >= 0) wheel->level_count[level]--;
+    wheel->scheduled--;
+
+    entry->prev->next = entry->next;
+    entry->next->prev = entry->prev;
+    if (level >= 0 && entry->next == entry->prev) {
+        uint64_t bit;
+        *wheel_occupancy(wheel, entry->bucket, &bit) &= ~bit;
+    }
+    if (wheel->next_valid && entry->deadline_ms == wheel->next_ms) {
+        wheel->next_valid = false;
+    }
+
+    entry->next = entry->prev = NULL;
+    entry->bucket = DOP_WHEEL_UNSCHEDULED;
+}
+
+// Picks the finest level whose window contains the deadline, measured in
+// whole units of that level relative to wheel time.
+static void wheel_place(dop_timing_wheel_t* wheel, dop_wheel_entry_t* entry) {
+    uint64_t deadline = entry->deadline_ms;
+    uint64_t now = wheel->now_ms;
+    uint32_t bucket;
+
+    if (deadline <= now) {
+        bucket = WHEEL_BUCKET_DUE;
+    } else if (deadline / WHEEL_MS_PER_SECOND == now / WHEEL_MS_PER_SECOND) {
+        bucket = (uint32_t)(deadline % WHEEL_MS_PER_SECOND);
+    } else if (deadline / WHEEL_MS_PER_MINUTE == now / WHEEL_MS_PER_MINUTE) {
+        bucket = WHEEL_BUCKET_L1 + (uint32_t)((deadline / WHEEL_MS_PER_SECOND) % 60);
+    } else if (deadline / WHEEL_MS_PER_HOUR == now / WHEEL_MS_PER_HOUR) {
+        bucket = WHEEL_BUCKET_L2 + (uint32_t)((deadline / WHEEL_MS_PER_MINUTE) % 60);
+    } else if (deadline / WHEEL_MS_PER_HOUR - now / WHEEL_MS_PER_HOUR < 24) {
+        bucket = WHEEL_BUCKET_L3 + (uint32_t)((deadline / WHEEL_MS_PER_HOUR) % 24);
+    } else {
+        bucket = WHEEL_BUCKET_OVERFLOW;
+    }
+
+    dop_wheel_bucket_t* target = wheel_bucket(wheel, bucket);
+    entry->bucket = bucket;
+    entry->prev = target->head.prev;
+    entry->next = &target->head;
+    target->head.prev->next = entry;
+    target->head.prev = entry;
+
+    int level = wheel_bucket_level(bucket);
+    if (level >= 0) {
+        uint64_t bit;
+        *wheel_occupancy(wheel, bucket, &bit) |= bit;
+        wheel->level_count[level]++;
+    }
+    wheel->scheduled++;
+
+    if (wheel->next_valid && deadline < wheel->next_ms) {
+        wheel->next_ms = deadline;
+    }
+}
+
+// Re-places every entry of a coarser bucket against the new wheel time.
+// Overflow entries still a day or more away land back in the same list,
+// behind the last original entry, so the walk stops there.
+static void wheel_cascade(dop_timing_wheel_t* wheel, dop_wheel_bucket_t* bucket) {
+    if (wheel_bucket_empty(bucket)) return;
+
+    dop_wheel_entry_t* last = bucket->head.prev;
+    dop_wheel_entry_t* entry = bucket->head.next;
+    for (;;) {
+        dop_wheel_entry_t* next = entry->next;
+        wheel_unlink(wheel, entry);
+        wheel_place(wheel, entry);
+        if (entry == last) break;
+        entry = next;
+    }
+}
+
+// Unlinks a bucket's entries into the firing batch. Entries leave the wheel
+// here, under the lock, so setters may reschedule them while they fire, and
+// stay pinned until the batch is done so destroy waits for the callbacks.
+typedef struct wheel_batch {
+    dop_component_t** components;
+    size_t count;
+    size_t capacity;
+    dop_timing_wheel_t* wheel;
+    struct wheel_batch* outer;     // Batch of an enclosing advance on this thread
+} wheel_batch_t;
+
+// Batches this thread is firing, innermost first
+static _Thread_local wheel_batch_t* t_wheel_firing = NULL;
+
+static void wheel_collect(dop_timing_wheel_t* wheel, dop_wheel_bucket_t* bucket, wheel_batch_t* batch) {
+    while (!wheel_bucket_empty(bucket)) {
+        dop_wheel_entry_t* entry = bucket->head.next;
+        if (batch->count == batch->capacity) {
+            size_t capacity = batch->capacity ? batch->capacity * 2 : 64;
+            dop_component_t** grown = realloc(batch->components, capacity * sizeof(dop_component_t*));
+            if (!grown) return; // Left in place; retried on the next advance
+            batch->components = grown;
+            batch->capacity = capacity;
+        }
+        wheel_unlink(wheel, entry);
+        entry->pins++;
+        batch->components[batch->count++] = wheel_owner(entry);
+    }
+}
+
+static uint64_t wheel_bucket_earliest(const dop_wheel_bucket_t* bucket) {
+    uint64_t earliest = UINT64_MAX;
+    for (const dop_wheel_entry_t* entry = bucket->head.next; entry != &bucket->head; entry = entry->next) {
+        if (entry->deadline_ms < earliest) earliest = entry->deadline_ms;
+    }
+    return earliest;
+}
+
+// Caller holds wheel->mutex. Every deadline in a finer level precedes every
+// one in a coarser level, and within a level the lowest occupied bucket
+// after wheel time holds the earliest. Level0 buckets are exact
+// milliseconds of the current second; coarser ones need a walk.
+static uint64_t wheel_next_deadline(dop_timing_wheel_t* wheel) {
+    if (!wheel_bucket_empty(&wheel->due)) {
+        return wheel->now_ms;
+    }
+    if (wheel->next_valid) {
+        return wheel->next_ms;
+    }
+
+    uint64_t now = wheel->now_ms;
+    uint64_t next = UINT64_MAX;
+    if (wheel->level_count[0] > 0) {
+        for (uint32_t word = 0; word < 16; word++) {
+            if (wheel->occupied[word]) {
+                next = now - now % WHEEL_MS_PER_SECOND +
+                       word * 64 + (uint32_t)__builtin_ctzll(wheel->occupied[word]);
+                break;
+            }
+        }
+    } else if (wheel->level_count[1] > 0) {
+        next = wheel_bucket_earliest(&wheel->level1[__builtin_ctzll(wheel->occupied[16])]);
+    } else if (wheel->level_count[2] > 0) {
+        next = wheel_bucket_earliest(&wheel->level2[__builtin_ctzll(wheel->occupied[17])]);
+    } else if (wheel->level_count[3] > 0) {
+        // Hours wrap, so rotate the bits to start after the current hour
+        uint32_t first = (uint32_t)((now / WHEEL_MS_PER_HOUR) % 24) + 1;
+        uint64_t mask = wheel->occupied[18];
+        uint64_t rotated = ((mask >> first) | (mask << (24 - first))) & 0xFFFFFFull;
+        next = wheel_bucket_earliest(&wheel->level3[(first + (uint32_t)__builtin_ctzll(rotated)) % 24]);
+    } else {
+        next = wheel_bucket_earliest(&wheel->overflow);
+    }
+
+    wheel->next_ms = next;
+    wheel->next_valid = true;
+    return next;
+}
+
+// Caller holds wheel->mutex
+static void wheel_notify(dop_timing_wheel_t* wheel, uint64_t next_ms) {
+    if (!wheel->notify || next_ms == wheel->notify_ms) return;
+    wheel->notify_ms = next_ms;
+    wheel->notify(next_ms, wheel->notify_context);
+}
+
+// Wheel Lifecycle
+dop_timing_wheel_t* dop_timing_wheel_create(uint64_t now_ms) {
+    dop_timing_wheel_t* wheel = calloc(1, sizeof(dop_timing_wheel_t));
+    if (!wheel) return NULL;
+
+    pthread_mutex_init(&wheel->mutex, NULL);
+    pthread_cond_init(&wheel->unpinned, NULL);
+    wheel->now_ms = now_ms;
+    wheel->notify_ms = UINT64_MAX;
+
+    for (int i = 0; i < 1000; i++) wheel_bucket_init(&wheel->level0[i]);
+    for (int i = 0; i < 60; i++) wheel_bucket_init(&wheel->level1[i]);
+    for (int i = 0; i < 60; i++) wheel_bucket_init(&wheel->level2[i]);
+    for (int i = 0; i < 24; i++) wheel_bucket_init(&wheel->level3[i]);
+    wheel_bucket_init(&wheel->overflow);
+    wheel_bucket_init(&wheel->due);
+
+    return wheel;
+}
+
+void dop_timing_wheel_destroy(dop_timing_wheel_t* wheel) {
+    if (!wheel) return;
+
+    // Detach anything still scheduled so components do not point into freed memory
+    for (uint32_t bucket = 0; bucket <= WHEEL_BUCKET_DUE; bucket++) {
+        dop_wheel_bucket_t* list = wheel_bucket(wheel, bucket);
+        while (!wheel_bucket_empty(list)) {
+            wheel_unlink(wheel, list->head.next);
+        }
+    }
+
+    pthread_cond_destroy(&wheel->unpinned);
+    pthread_mutex_destroy(&wheel->mutex);
+    free(wheel);
+}
+
+static void wheel_default_init(void) {
+    g_default_wheel = dop_timing_wheel_create(dop_time_monotonic_ms());
+}
+
+dop_timing_wheel_t* dop_timing_wheel_default(void) {
+    pthread_once(&g_default_wheel_once, wheel_default_init);
+    return g_default_wheel;
+}
+
+// Scheduling
+int dop_timing_wheel_schedule(dop_timing_wheel_t* wheel, dop_component_t* component, uint64_t deadline_ms) {
+    if (!wheel || !component) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&wheel->mutex);
+    dop_wheel_entry_t* entry = &component->wheel_entry;
+    if (entry->bucket != DOP_WHEEL_UNSCHEDULED) {
+        wheel_unlink(wheel, entry);
+    }
+    entry->deadline_ms = deadline_ms;
+    wheel_place(wheel, entry);
+    if (deadline_ms < wheel->notify_ms) {
+        wheel_notify(wheel, deadline_ms);
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+
+    return DOP_SUCCESS;
+}
+
+int dop_timing_wheel_schedule_batch(dop_timing_wheel_t* wheel, dop_component_t* const* components,
+                                    const uint64_t* deadlines_ms, size_t count) {
+    if (!wheel || (count > 0 && (!components || !deadlines_ms))) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&wheel->mutex);
+    uint64_t earliest = UINT64_MAX;
+    for (size_t i = 0; i < count; i++) {
+        if (!components[i]) continue;
+        dop_wheel_entry_t* entry = &components[i]->wheel_entry;
+        if (entry->bucket != DOP_WHEEL_UNSCHEDULED) {
+            wheel_unlink(wheel, entry);
+        }
+        entry->deadline_ms = deadlines_ms[i];
+        wheel_place(wheel, entry);
+        if (deadlines_ms[i] < earliest) earliest = deadlines_ms[i];
+    }
+    if (earliest < wheel->notify_ms) {
+        wheel_notify(wheel, earliest);
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+
+    return DOP_SUCCESS;
+}
+
+int dop_timing_wheel_cancel(dop_timing_wheel_t* wheel, dop_component_t* component) {
+    if (!wheel || !component) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&wheel->mutex);
+    dop_wheel_entry_t* entry = &component->wheel_entry;
+    if (entry->bucket != DOP_WHEEL_UNSCHEDULED) {
+        wheel_unlink(wheel, entry);
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+
+    return DOP_SUCCESS;
+}
+
+// Caller holds wheel->mutex. Pins held by this thread's own batches are
+// dropped and their slots cleared, since those callbacks cannot return
+// while we wait; pins of other threads' batches are waited out.
+static void wheel_release_locked(dop_timing_wheel_t* wheel, dop_component_t* component) {
+    dop_wheel_entry_t* entry = &component->wheel_entry;
+    if (entry->bucket != DOP_WHEEL_UNSCHEDULED) {
+        wheel_unlink(wheel, entry);
+    }
+
+    for (wheel_batch_t* batch = t_wheel_firing; batch && entry->pins > 0; batch = batch->outer) {
+        if (batch->wheel != wheel) continue;
+        for (size_t i = 0; i < batch->count; i++) {
+            if (batch->components[i] == component) {
+                batch->components[i] = NULL;
+                entry->pins--;
+            }
+        }
+    }
+
+    while (entry->pins > 0) {
+        pthread_cond_wait(&wheel->unpinned, &wheel->mutex);
+    }
+}
+
+void dop_timing_wheel_release(dop_timing_wheel_t* wheel, dop_component_t* component) {
+    if (!wheel || !component) return;
+
+    pthread_mutex_lock(&wheel->mutex);
+    wheel_release_locked(wheel, component);
+    pthread_mutex_unlock(&wheel->mutex);
+}
+
+void dop_timing_wheel_release_batch(dop_timing_wheel_t* wheel, dop_component_t* const* components, size_t count) {
+    if (!wheel || !components) return;
+
+    pthread_mutex_lock(&wheel->mutex);
+    for (size_t i = 0; i < count; i++) {
+        if (components[i]) wheel_release_locked(wheel, components[i]);
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+}
+
+bool dop_timing_wheel_is_scheduled(const dop_component_t* component) {
+    return component && component->wheel_entry.bucket != DOP_WHEEL_UNSCHEDULED;
+}
+
+uint64_t dop_timing_wheel_deadline(dop_timing_wheel_t* wheel, const dop_component_t* component) {
+    if (!wheel || !component) return UINT64_MAX;
+
+    pthread_mutex_lock(&wheel->mutex);
+    uint64_t deadline_ms = component->wheel_entry.bucket != DOP_WHEEL_UNSCHEDULED ?
+                           component->wheel_entry.deadline_ms : UINT64_MAX;
+    pthread_mutex_unlock(&wheel->mutex);
+
+    return deadline_ms;
+}
+
+// Driver
+size_t dop_timing_wheel_advance(dop_timing_wheel_t* wheel, uint64_t now_ms,
+                                dop_wheel_fire_t fire, void* context) {
+    if (!wheel) return 0;
+
+    wheel_batch_t fired = { NULL, 0, 0, wheel, t_wheel_firing };
+
+    pthread_mutex_lock(&wheel->mutex);
+
+    wheel_collect(wheel, &wheel->due, &fired);
+
+    while (wheel->now_ms < now_ms) {
+        uint64_t now = wheel->now_ms;
+
+        // Jump straight to the next boundary of the finest non-empty level
+        uint64_t horizon = now + 1;
+        if (wheel->level_count[0] == 0) {
+            horizon = (now / WHEEL_MS_PER_SECOND + 1) * WHEEL_MS_PER_SECOND;
+            if (wheel->level_count[1] == 0) {
+                horizon = (now / WHEEL_MS_PER_MINUTE + 1) * WHEEL_MS_PER_MINUTE;
+                if (wheel->level_count[2] == 0) {
+                    horizon = (now / WHEEL_MS_PER_HOUR + 1) * WHEEL_MS_PER_HOUR;
+                    if (wheel->level_count[3] == 0 && wheel_bucket_empty(&wheel->overflow)) {
+                        horizon = now_ms;
+                    }
+                }
+            }
+        }
+        if (horizon > now_ms) horizon = now_ms;
+        wheel->now_ms = horizon;
+
+        // Crossing a boundary pulls the matching coarse bucket down a level
+        if (horizon % WHEEL_MS_PER_SECOND == 0) {
+            if (horizon % WHEEL_MS_PER_MINUTE == 0) {
+                if (horizon % WHEEL_MS_PER_HOUR == 0) {
+                    wheel_cascade(wheel, &wheel->overflow);
+                    wheel_cascade(wheel, &wheel->level3[(horizon / WHEEL_MS_PER_HOUR) % 24]);
+                }
+                wheel_cascade(wheel, &wheel->level2[(horizon / WHEEL_MS_PER_MINUTE) % 60]);
+            }
+            wheel_cascade(wheel, &wheel->level1[(horizon / WHEEL_MS_PER_SECOND) % 60]);
+        }
+
+        wheel_collect(wheel, &wheel->level0[horizon % WHEEL_MS_PER_SECOND], &fired);
+        wheel_collect(wheel, &wheel->due, &fired);
+    }
+
+    if (wheel->notify) {
+        wheel_notify(wheel, wheel_next_deadline(wheel));
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+
+    if (fired.count == 0) return 0;
+
+    // Fire outside the wheel lock; setters lock component before wheel.
+    // Timers go first as one batch, which skips everything else. A slot is
+    // cleared if a callback destroys its component.
+    t_wheel_firing = &fired;
+    dop_timer_expire_batch(fired.components, fired.count, dop_time_monotonic_ns());
+
+    for (size_t i = 0; i < fired.count; i++) {
+        dop_component_t* component = fired.components[i];
+        if (component && component->metadata.type == DOP_COMPONENT_ALARM) {
+            dop_alarm_trigger(component);
+        }
+        component = fired.components[i];
+        if (component && fire) fire(component, context);
+    }
+    t_wheel_firing = fired.outer;
+
+    bool unpinned = false;
+    pthread_mutex_lock(&wheel->mutex);
+    for (size_t i = 0; i < fired.count; i++) {
+        if (fired.components[i] && --fired.components[i]->wheel_entry.pins == 0) {
+            unpinned = true;
+        }
+    }
+    if (unpinned) pthread_cond_broadcast(&wheel->unpinned);
+    pthread_mutex_unlock(&wheel->mutex);
+
+    size_t fired_count = fired.count;
+    free(fired.components);
+    return fired_count;
+}
+
+int dop_timing_wheel_set_notify(dop_timing_wheel_t* wheel, dop_wheel_notify_t notify, void* context) {
+    if (!wheel) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&wheel->mutex);
+    if (notify && wheel->notify && (wheel->notify != notify || wheel->notify_context != context)) {
+        pthread_mutex_unlock(&wheel->mutex);
+        return DOP_ERROR_INVALID_STATE; // One listener per wheel
+    }
+    wheel->notify = notify;
+    wheel->notify_context = context;
+    wheel->notify_ms = UINT64_MAX;
+    if (notify) {
+        uint64_t next_ms = wheel_next_deadline(wheel);
+        if (next_ms != UINT64_MAX) wheel_notify(wheel, next_ms);
+    }
+    pthread_mutex_unlock(&wheel->mutex);
+
+    return DOP_SUCCESS;
+}
+
+uint64_t dop_timing_wheel_next_deadline(dop_timing_wheel_t* wheel) {
+    if (!wheel) return UINT64_MAX;
+
+    pthread_mutex_lock(&wheel->mutex);
+    uint64_t next = wheel_next_deadline(wheel);
+    pthread_mutex_unlock(&wheel->mutex);
+
+    return next;
+}
@@ -3,11 +3,13 @@
 // Corrected to match header structure definitions
 
 #include "dop_topology.h"
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <string.h>
 
 // Define constants based on header structure definitions
 #define DOP_MAX_PEERS 4    // Based on peers[4] array in header
+#define DOP_MAX_NODES 16   // Based on nodes[16] array in header
 
 dop_topology_node_t* dop_topology_create_node(const char* node_id, dop_component_t* component) {
     if (!node_id || !component) return NULL;
@@ -49,50 +51,81 @@ int dop_topology_add_peer(dop_topology_node_t* node, dop_topology_node_t* peer)
 int dop_topology_start_p2p_network(dop_build_topology_t* topology) {
     if (!topology) return DOP_ERROR_INVALID_PARAMETER;
     
-    // Initialize all nodes in the topology
-    for (uint32_t i = 0; i < topology->node_count; i++) {
+    // Collect node components so their gates open in one pass
+    dop_component_t* components[DOP_MAX_NODES] = { NULL };
+    uint32_t component_count = 0;
+    for (uint32_t i = 0; i < topology->node_count && i < DOP_MAX_NODES; i++) {
         dop_topology_node_t* node = topology->nodes[i];
         if (node && node->component) {
-            // Open governance gates for P2P operation
-            dop_gate_open(node->component);
-            
-            // Update component state for network operation
-            dop_func_update_component(node->component);
+            components[component_count++] = node->component;
         }
     }
     
+    // Open governance gates for P2P operation
+    dop_gate_set_bulk(components, component_count, DOP_GATE_OPEN);
+    
+    // Update component state for network operation
+    for (uint32_t i = 0; i < component_count; i++) {
+        dop_func_update_component(components[i]);
+    }
+    
     topology->is_p2p_enabled = true;
     return DOP_SUCCESS;
 }
 
+// Puts a gate back to the state it had before a fault test
+static void topology_restore_gate(dop_component_t* component, dop_gate_state_t state) {
+    switch (state) {
+        case DOP_GATE_OPEN:
+            dop_gate_open(component);
+            break;
+        case DOP_GATE_ISOLATED:
+            dop_gate_isolate(component);
+            break;
+        default:
+            dop_gate_close(component);
+            break;
+    }
+}
+
 int dop_topology_test_fault_tolerance(dop_build_topology_t* topology) {
     if (!topology) return DOP_ERROR_INVALID_PARAMETER;
     
+    // Collect node components once
+    dop_component_t* components[DOP_MAX_NODES] = { NULL };
+    bool fault_tolerant[DOP_MAX_NODES] = { false };
+    uint32_t component_count = 0;
+    for (uint32_t i = 0; i < topology->node_count && i < DOP_MAX_NODES; i++) {
+        dop_topology_node_t* node = topology->nodes[i];
+        if (node && node->component) {
+            fault_tolerant[component_count] = node->is_fault_tolerant;
+            components[component_count++] = node->component;
+        }
+    }
+    
     // Test fault tolerance by simulating node failure and recovery
-    for (uint32_t i = 0; i < topology->node_count; i++) {
-        dop_topology_node_t* test_node = topology->nodes[i];
-        if (test_node && test_node->component && test_node->is_fault_tolerant) {
-            // Simulate node isolation
-            dop_gate_isolate(test_node->component);
-            
-            // Verify other nodes continue operation
-            bool network_operational = true;
-            for (uint32_t j = 0; j < topology->node_count; j++) {
-                if (j != i && topology->nodes[j] && topology->nodes[j]->component) {
-                    if (!dop_gate_is_accessible(topology->nodes[j]->component)) {
-                        network_operational = false;
-                        break;
-                    }
-                }
-            }
-            
-            // Restore isolated node
-            dop_gate_open(test_node->component);
-            
-            if (!network_operational) {
-                return DOP_ERROR_TOPOLOGY_FAULT;
+    for (uint32_t i = 0; i < component_count; i++) {
+        if (!fault_tolerant[i]) continue;
+        
+        // Simulate node isolation
+        dop_gate_state_t prior = atomic_load_explicit(&components[i]->metadata.gate_state, memory_order_acquire);
+        dop_gate_isolate(components[i]);
+        
+        // Verify other nodes continue operation
+        bool network_operational = true;
+        for (uint32_t j = 0; j < component_count; j++) {
+            if (j != i && !dop_gate_is_accessible(components[j])) {
+                network_operational = false;
+                break;
             }
         }
+        
+        // Restore isolated node to its prior state
+        topology_restore_gate(components[i], prior);
+        
+        if (!network_operational) {
+            return DOP_ERROR_TOPOLOGY_FAULT;
+        }
     }
     
     return DOP_SUCCESS;
@@ -0,0 +1,453 @@
+// src/dop_tz.c
+// OBINexus DOP Timezone Table Implementation
+// TZif loading, POSIX rule expansion and offset lookup by binary search
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dop_tz.h"
+#include "dop_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#define TZ_FILE_MAX          (1u << 20)
+#define TZ_DEFAULT_DIR       "/usr/share/zoneinfo"
+#define TZ_SECONDS_PER_DAY   86400
+#define TZ_DEFAULT_RULE_TIME 7200      // 02:00 when a rule gives no time
+
+typedef struct {
+    char name[DOP_TZ_NAME_MAX + 1];
+    int32_t initial_offset;         // Before the first transition
+    uint32_t count;
+    _Atomic uint32_t hint;          // Last transition found; any value is safe
+    int64_t* at;                    // UTC seconds, ascending
+    int32_t* offset;                // Seconds east of UTC from at[i]
+} dop_tz_t;
+
+static pthread_mutex_t g_tz_mutex = PTHREAD_MUTEX_INITIALIZER;
+static _Atomic(dop_tz_t*) g_tz_zones[DOP_TZ_MAX_ZONES + 1];   // Indexed by id; 0 is DOP_TZ_LOCAL
+static uint32_t g_tz_count = 0;
+
+// Calendar Arithmetic
+static int64_t tz_days_from_civil(int64_t year, uint32_t month, uint32_t day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t year_of_era = year - era * 400;
+    int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+static int64_t tz_year_of(int64_t epoch_second) {
+    int64_t days = epoch_second / TZ_SECONDS_PER_DAY - (epoch_second % TZ_SECONDS_PER_DAY < 0);
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t day_of_era = days - era * 146097;
+    int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    int64_t month_index = (5 * day_of_year + 2) / 153;
+    return year_of_era + era * 400 + (month_index >= 10);
+}
+
+static inline bool tz_is_leap(int64_t year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static inline uint32_t tz_weekday(int64_t days) {
+    return (uint32_t)(((days % 7) + 11) % 7);   // 1970-01-01 was a Thursday
+}
+
+// POSIX TZ Rules (the TZif footer)
+typedef enum { TZ_RULE_JULIAN, TZ_RULE_ZERO_BASED, TZ_RULE_MONTH } tz_rule_kind_t;
+
+typedef struct {
+    tz_rule_kind_t kind;
+    uint32_t day;                   // Julian 1..365, zero-based 0..365, or weekday 0..6
+    uint32_t week;                  // 1..5, 5 = last
+    uint32_t month;                 // 1..12
+    int32_t time;                   // Seconds after local midnight
+} tz_rule_date_t;
+
+typedef struct {
+    int32_t std_offset;             // Seconds east of UTC
+    int32_t dst_offset;
+    bool has_dst;
+    tz_rule_date_t start;           // Into DST, in standard time
+    tz_rule_date_t end;             // Out of DST, in DST
+} tz_rule_t;
+
+static const char* tz_parse_name(const char* cursor) {
+    if (*cursor == '<') {
+        const char* close = strchr(cursor, '>');
+        return close ? close + 1 : NULL;
+    }
+    const char* start = cursor;
+    while ((*cursor >= 'A' && *cursor <= 'Z') || (*cursor >= 'a' && *cursor <= 'z')) cursor++;
+    return cursor - start >= 3 ? cursor : NULL;
+}
+
+static const char* tz_parse_number(const char* cursor, int32_t max, int32_t* value) {
+    if (*cursor < '0' || *cursor > '9') return NULL;
+    int32_t result = 0;
+    while (*cursor >= '0' && *cursor <= '9') {
+        result = result * 10 + (*cursor++ - '0');
+        if (result > max) return NULL;
+    }
+    *value = result;
+    return cursor;
+}
+
+// [+-]hh[:mm[:ss]] with hours up to 167 (TZif v3 rule times)
+static const char* tz_parse_hms(const char* cursor, int32_t* seconds) {
+    int32_t sign = 1;
+    if (*cursor == '+' || *cursor == '-') {
+        if (*cursor == '-') sign = -1;
+        cursor++;
+    }
+
+    int32_t hours, minutes = 0, secs = 0;
+    cursor = tz_parse_number(cursor, 167, &hours);
+    if (cursor && *cursor == ':') {
+        cursor = tz_parse_number(cursor + 1, 59, &minutes);
+        if (cursor && *cursor == ':') cursor = tz_parse_number(cursor + 1, 59, &secs);
+    }
+    if (!cursor) return NULL;
+
+    *seconds = sign * (hours * 3600 + minutes * 60 + secs);
+    return cursor;
+}
+
+static const char* tz_parse_date(const char* cursor, tz_rule_date_t* date) {
+    int32_t value;
+    if (*cursor == 'J') {
+        date->kind = TZ_RULE_JULIAN;
+        cursor = tz_parse_number(cursor + 1, 365, &value);
+        if (!cursor || value < 1) return NULL;
+        date->day = (uint32_t)value;
+    } else if (*cursor == 'M') {
+        int32_t month, week, day;
+        date->kind = TZ_RULE_MONTH;
+        cursor = tz_parse_number(cursor + 1, 12, &month);
+        if (!cursor || *cursor != '.' || month < 1) return NULL;
+        cursor = tz_parse_number(cursor + 1, 5, &week);
+        if (!cursor || *cursor != '.' || week < 1) return NULL;
+        cursor = tz_parse_number(cursor + 1, 6, &day);
+        if (!cursor) return NULL;
+        date->month = (uint32_t)month;
+        date->week = (uint32_t)week;
+        date->day = (uint32_t)day;
+    } else {
+        date->kind = TZ_RULE_ZERO_BASED;
+        cursor = tz_parse_number(cursor, 365, &value);
+        if (!cursor) return NULL;
+        date->day = (uint32_t)value;
+    }
+
+    date->time = TZ_DEFAULT_RULE_TIME;
+    if (*cursor == '/') cursor = tz_parse_hms(cursor + 1, &date->time);
+    return cursor;
+}
+
+static bool tz_parse_rule(const char* text, tz_rule_t* rule) {
+    memset(rule, 0, sizeof(*rule));
+
+    int32_t west;
+    const char* cursor = tz_parse_name(text);
+    if (!cursor || !(cursor = tz_parse_hms(cursor, &west))) return false;
+    rule->std_offset = -west;
+    if (*cursor == '\0') return true;
+
+    // POSIX offsets count west of UTC; DST defaults to one hour ahead
+    if (!(cursor = tz_parse_name(cursor))) return false;
+    rule->has_dst = true;
+    rule->dst_offset = rule->std_offset + 3600;
+    if (*cursor && *cursor != ',') {
+        if (!(cursor = tz_parse_hms(cursor, &west))) return false;
+        rule->dst_offset = -west;
+    }
+
+    if (*cursor == '\0') {
+        // No dates given: the historical US default
+        rule->start = (tz_rule_date_t){ TZ_RULE_MONTH, 0, 2, 3, TZ_DEFAULT_RULE_TIME };
+        rule->end = (tz_rule_date_t){ TZ_RULE_MONTH, 0, 1, 11, TZ_DEFAULT_RULE_TIME };
+        return true;
+    }
+
+    if (*cursor != ',' || !(cursor = tz_parse_date(cursor + 1, &rule->start))) return false;
+    if (*cursor != ',' || !(cursor = tz_parse_date(cursor + 1, &rule->end))) return false;
+    return *cursor == '\0';
+}
+
+// Local midnight (as a day number) on which a rule date falls in a year
+static int64_t tz_rule_day(const tz_rule_date_t* date, int64_t year) {
+    int64_t january_first = tz_days_from_civil(year, 1, 1);
+
+    switch (date->kind) {
+        case TZ_RULE_JULIAN:
+            // Feb 29 is never counted
+            return january_first + date->day - 1 + (tz_is_leap(year) && date->day >= 60);
+        case TZ_RULE_ZERO_BASED:
+            return january_first + date->day;
+        default: {
+            static const uint8_t month_days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            int64_t first = tz_days_from_civil(year, date->month, 1);
+            uint32_t length = month_days[date->month - 1] + (date->month == 2 && tz_is_leap(year));
+            int64_t day = first + (date->day + 7 - tz_weekday(first)) % 7 + (int64_t)(date->week - 1) * 7;
+            while (day >= first + length) day -= 7;
+            return day;
+        }
+    }
+}
+
+// Table Building
+typedef struct {
+    int64_t* at;
+    int32_t* offset;
+    uint32_t count;
+    uint32_t capacity;
+} tz_builder_t;
+
+static bool tz_builder_push(tz_builder_t* builder, int64_t at, int32_t offset) {
+    // Transitions that change nothing only cost lookups
+    if (builder->count > 0) {
+        if (at <= builder->at[builder->count - 1]) return true;
+        if (offset == builder->offset[builder->count - 1]) return true;
+    }
+
+    if (builder->count == builder->capacity) {
+        uint32_t capacity = builder->capacity ? builder->capacity * 2 : 256;
+        int64_t* at_grown = realloc(builder->at, capacity * sizeof(int64_t));
+        if (at_grown) builder->at = at_grown;
+        int32_t* offset_grown = at_grown ? realloc(builder->offset, capacity * sizeof(int32_t)) : NULL;
+        if (!offset_grown) return false;
+        builder->offset = offset_grown;
+        builder->capacity = capacity;
+    }
+
+    builder->at[builder->count] = at;
+    builder->offset[builder->count] = offset;
+    builder->count++;
+    return true;
+}
+
+static bool tz_expand_rule(tz_builder_t* builder, const tz_rule_t* rule, int64_t from) {
+    if (!rule->has_dst) return tz_builder_push(builder, from, rule->std_offset);
+
+    for (int64_t year = tz_year_of(from); year <= DOP_TZ_RULE_LAST_YEAR; year++) {
+        int64_t start = tz_rule_day(&rule->start, year) * TZ_SECONDS_PER_DAY + rule->start.time - rule->std_offset;
+        int64_t end = tz_rule_day(&rule->end, year) * TZ_SECONDS_PER_DAY + rule->end.time - rule->dst_offset;
+
+        // Southern hemisphere zones leave DST before they enter it
+        bool ok = start < end ?
+                  tz_builder_push(builder, start, rule->dst_offset) && tz_builder_push(builder, end, rule->std_offset) :
+                  tz_builder_push(builder, end, rule->std_offset) && tz_builder_push(builder, start, rule->dst_offset);
+        if (!ok) return false;
+    }
+    return true;
+}
+
+static inline uint32_t tz_be32(const uint8_t* p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static inline int64_t tz_be64(const uint8_t* p) {
+    return (int64_t)((uint64_t)tz_be32(p) << 32 | tz_be32(p + 4));
+}
+
+// Parses a TZif file (RFC 8536), preferring the 64-bit block of v2+
+static bool tz_compile(const uint8_t* data, size_t size, dop_tz_t* zone) {
+    if (size < 44 || memcmp(data, "TZif", 4) != 0) return false;
+
+    const uint8_t* header = data;
+    bool wide = false;
+    size_t time_size = 4;
+
+    for (;;) {
+        uint32_t isut = tz_be32(header + 20), isstd = tz_be32(header + 24), leap = tz_be32(header + 28);
+        uint32_t times = tz_be32(header + 32), types = tz_be32(header + 36), chars = tz_be32(header + 40);
+        if (types == 0 || times > 100000 || types > 256 || leap > 100000 || chars > 65536 ||
+            isut > types || isstd > types) {
+            return false;
+        }
+
+        size_t block = times * time_size + times + types * 6 + chars + leap * (time_size + 4) + isstd + isut;
+        const uint8_t* body = header + 44;
+        if ((size_t)(body - data) + block > size) return false;
+
+        // A v1 block precedes the 64-bit one; skip to it
+        if (!wide && header[4] >= '2') {
+            header = body + block;
+            if ((size_t)(header - data) + 44 > size || memcmp(header, "TZif", 4) != 0) return false;
+            wide = true;
+            time_size = 8;
+            continue;
+        }
+
+        const uint8_t* transition_times = body;
+        const uint8_t* transition_types = transition_times + times * time_size;
+        const uint8_t* type_records = transition_types + times;
+
+        tz_builder_t builder = { NULL, NULL, 0, 0 };
+        zone->initial_offset = (int32_t)tz_be32(type_records);
+        for (uint32_t i = 0; i < times; i++) {
+            uint8_t type = transition_types[i];
+            if (type >= types) goto fail;
+            int64_t at = wide ? tz_be64(transition_times + i * 8) : (int32_t)tz_be32(transition_times + i * 4);
+            int32_t offset = (int32_t)tz_be32(type_records + type * 6);
+            if (builder.count == 0 && offset == zone->initial_offset) continue;
+            if (!tz_builder_push(&builder, at, offset)) goto fail;
+        }
+
+        // Footer: the rule for instants past the recorded transitions
+        const uint8_t* footer = body + block;
+        if (wide && footer < data + size && *footer == '\n') {
+            const uint8_t* footer_end = memchr(footer + 1, '\n', (size_t)(data + size - footer - 1));
+            char text[128];
+            size_t length = footer_end ? (size_t)(footer_end - footer - 1) : 0;
+            tz_rule_t rule;
+            if (length > 0 && length < sizeof(text)) {
+                memcpy(text, footer + 1, length);
+                text[length] = '\0';
+                int64_t from = times > 0 ? tz_be64(transition_times + (times - 1) * 8) + 1 : 0;
+                if (tz_parse_rule(text, &rule) && !tz_expand_rule(&builder, &rule, from)) goto fail;
+            }
+        }
+
+        zone->at = builder.at;
+        zone->offset = builder.offset;
+        zone->count = builder.count;
+        return true;
+
+    fail:
+        free(builder.at);
+        free(builder.offset);
+        return false;
+    }
+}
+
+// Rejects anything that could leave the zoneinfo directory
+static bool tz_name_valid(const char* name) {
+    size_t length = strnlen(name, DOP_TZ_NAME_MAX + 1);
+    if (length == 0 || length > DOP_TZ_NAME_MAX || name[0] == '/' || strstr(name, "..")) return false;
+
+    for (size_t i = 0; i < length; i++) {
+        char c = name[i];
+        bool allowed = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                       c == '/' || c == '_' || c == '-' || c == '+';
+        if (!allowed) return false;
+    }
+    return true;
+}
+
+static dop_tz_t* tz_read(const char* name) {
+    const char* directory = getenv("TZDIR");
+    char path[512];
+    int written = snprintf(path, sizeof(path), "%s/%s", directory && *directory ? directory : TZ_DEFAULT_DIR, name);
+    if (written < 0 || (size_t)written >= sizeof(path)) return NULL;
+
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    uint8_t* data = malloc(TZ_FILE_MAX);
+    size_t size = data ? fread(data, 1, TZ_FILE_MAX, file) : 0;
+    fclose(file);
+
+    dop_tz_t* zone = calloc(1, sizeof(dop_tz_t));
+    if (!zone || !tz_compile(data, size, zone)) {
+        free(zone);
+        zone = NULL;
+    } else {
+        memcpy(zone->name, name, strlen(name) + 1);
+    }
+    free(data);
+    return zone;
+}
+
+// Zone Registry
+int dop_tz_load(const char* name, uint16_t* zone) {
+    if (!name || !zone || !tz_name_valid(name)) return DOP_ERROR_INVALID_PARAMETER;
+
+    pthread_mutex_lock(&g_tz_mutex);
+    for (uint32_t id = 1; id <= g_tz_count; id++) {
+        dop_tz_t* loaded = atomic_load_explicit(&g_tz_zones[id], memory_order_relaxed);
+        if (strcmp(loaded->name, name) == 0) {
+            pthread_mutex_unlock(&g_tz_mutex);
+            *zone = (uint16_t)id;
+            return DOP_SUCCESS;
+        }
+    }
+
+    dop_tz_t* loaded = g_tz_count < DOP_TZ_MAX_ZONES ? tz_read(name) : NULL;
+    if (!loaded) {
+        pthread_mutex_unlock(&g_tz_mutex);
+        return DOP_ERROR_INVALID_STATE;
+    }
+
+    uint32_t id = ++g_tz_count;
+    atomic_store_explicit(&g_tz_zones[id], loaded, memory_order_release);
+    pthread_mutex_unlock(&g_tz_mutex);
+
+    *zone = (uint16_t)id;
+    return DOP_SUCCESS;
+}
+
+static inline const dop_tz_t* tz_get(uint16_t zone) {
+    return zone > 0 && zone <= DOP_TZ_MAX_ZONES ?
+           atomic_load_explicit(&g_tz_zones[zone], memory_order_acquire) : NULL;
+}
+
+const char* dop_tz_name(uint16_t zone) {
+    const dop_tz_t* loaded = tz_get(zone);
+    return loaded ? loaded->name : NULL;
+}
+
+// Lookup
+static int32_t tz_lookup(dop_tz_t* zone, int64_t second) {
+    uint32_t count = zone->count;
+    if (count == 0 || second < zone->at[0]) return zone->initial_offset;
+
+    uint32_t hint = atomic_load_explicit(&zone->hint, memory_order_relaxed);
+    if (hint < count && zone->at[hint] <= second && (hint + 1 == count || second < zone->at[hint + 1])) {
+        return zone->offset[hint];
+    }
+
+    // Last transition at or before the instant
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (high - low > 1) {
+        uint32_t middle = low + (high - low) / 2;
+        if (zone->at[middle] <= second) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    atomic_store_explicit(&zone->hint, low, memory_order_relaxed);
+    return zone->offset[low];
+}
+
+int32_t dop_tz_offset(uint16_t zone, dop_time_t instant) {
+    if (zone == DOP_TZ_LOCAL) return dop_time_utc_offset(instant);
+
+    dop_tz_t* loaded = (dop_tz_t*)tz_get(zone);
+    return loaded ? tz_lookup(loaded, (int64_t)(instant / 1000)) : 0;
+}
+
+void dop_tz_offset_batch(const uint16_t* zones, size_t count, dop_time_t instant, int32_t* offsets) {
+    if (!zones || !offsets) return;
+
+    // Runs of the same zone share one lookup
+    uint16_t previous = 0;
+    int32_t previous_offset = 0;
+    bool have_previous = false;
+    for (size_t i = 0; i < count; i++) {
+        if (!have_previous || zones[i] != previous) {
+            previous = zones[i];
+            previous_offset = dop_tz_offset(previous, instant);
+            have_previous = true;
+        }
+        offsets[i] = previous_offset;
+    }
+}
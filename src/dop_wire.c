@@ -0,0 +1,313 @@
+// src/dop_wire.c
+// OBINexus DOP Binary Wire Format Implementation
+// Fixed-layout component records and zero-copy stream decoding
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "dop_wire.h"
+#include "dop_checksum.h"
+#include "dop_component_store.h"
+#include "dop_timing_wheel.h"
+#include "dop_alarm_index.h"
+#include "dop_time.h"
+#include <string.h>
+#include <stdatomic.h>
+
+// Zone ids differ between processes, so they are left out of the checksum
+static uint32_t wire_checksum(uint8_t algorithm, dop_component_type_t type, const dop_component_data_t* data) {
+    if (type != DOP_COMPONENT_CLOCK || data->clock.timezone_id == DOP_TZ_LOCAL) {
+        return dop_checksum_compute((dop_checksum_algorithm_t)algorithm, data, sizeof(dop_component_data_t));
+    }
+
+    dop_component_data_t portable = *data;
+    portable.clock.timezone_id = DOP_TZ_LOCAL;
+    return dop_checksum_compute((dop_checksum_algorithm_t)algorithm, &portable, sizeof(dop_component_data_t));
+}
+
+void dop_wire_pack(dop_wire_record_t* record, const dop_component_t* component,
+                   const dop_component_data_t* data, uint64_t sampled_ns) {
+    memset(record, 0, sizeof(dop_wire_record_t));
+
+    record->wire_version = DOP_WIRE_VERSION;
+    record->type = (uint8_t)component->metadata.type;
+    record->state = (uint8_t)component->metadata.state;
+    record->gate = (uint8_t)atomic_load_explicit(&component->metadata.gate_state, memory_order_acquire);
+    record->checksum_algorithm = component->checksum_algorithm;
+    record->checksum = dop_wire_le32(wire_checksum(component->checksum_algorithm, component->metadata.type, data));
+    record->handle = dop_wire_le32(component->handle);
+    record->last_update_timestamp = dop_wire_le64(component->metadata.last_update_timestamp);
+    record->sampled_ns = dop_wire_le64(sampled_ns);
+
+    const char* component_id = dop_component_id(component);
+    size_t id_length = strnlen(component_id, DOP_WIRE_ID_SIZE);
+    memcpy(record->component_id, component_id, id_length);
+    record->id_length = (uint8_t)id_length;
+
+    switch (component->metadata.type) {
+        case DOP_COMPONENT_ALARM:
+            record->data.alarm.alarm_time = dop_wire_le64(data->alarm.alarm_time);
+            record->data.alarm.current_time = dop_wire_le64(data->alarm.current_time);
+            record->data.alarm.snooze_duration_ms = dop_wire_le32(data->alarm.snooze_duration_ms);
+            record->data.alarm.is_armed = data->alarm.is_armed;
+            record->data.alarm.is_triggered = data->alarm.is_triggered;
+            record->data.alarm.repeat_days = data->alarm.repeat_days;
+            break;
+        case DOP_COMPONENT_CLOCK:
+            record->data.clock.current_time = dop_wire_le64(data->clock.current_time);
+            record->data.clock.timezone_offset = (int32_t)dop_wire_le32((uint32_t)data->clock.timezone_offset);
+            record->data.clock.is_running = data->clock.is_running;
+            record->data.clock.is_24_hour_format = data->clock.is_24_hour_format;
+            if (data->clock.timezone_id == DOP_TZ_FIXED) {
+                record->data.clock.timezone_kind = DOP_WIRE_TZ_FIXED;
+            } else if (data->clock.timezone_id != DOP_TZ_LOCAL) {
+                const char* zone_name = dop_tz_name(data->clock.timezone_id);
+                if (zone_name) {
+                    record->data.clock.timezone_kind = DOP_WIRE_TZ_NAMED;
+                    memcpy(record->data.clock.timezone, zone_name, strnlen(zone_name, DOP_TZ_NAME_MAX));
+                }
+            }
+            break;
+        case DOP_COMPONENT_STOPWATCH:
+            record->data.stopwatch.start_time = dop_wire_le64(data->stopwatch.start_time);
+            record->data.stopwatch.current_time = dop_wire_le64(data->stopwatch.current_time);
+            record->data.stopwatch.elapsed_ms = dop_wire_le64(data->stopwatch.elapsed_ms);
+            record->data.stopwatch.start_ns = dop_wire_le64(data->stopwatch.start_ns);
+            record->data.stopwatch.accumulated_ns = dop_wire_le64(data->stopwatch.accumulated_ns);
+            record->data.stopwatch.lap_count = dop_wire_le32(data->stopwatch.lap_count);
+            record->data.stopwatch.is_running = data->stopwatch.is_running;
+            record->data.stopwatch.is_paused = data->stopwatch.is_paused;
+            break;
+        case DOP_COMPONENT_TIMER:
+            record->data.timer.start_time = dop_wire_le64(data->timer.start_time);
+            record->data.timer.start_ns = dop_wire_le64(data->timer.start_ns);
+            record->data.timer.duration_ns = dop_wire_le64(data->timer.duration_ns);
+            record->data.timer.remaining_ns = dop_wire_le64(data->timer.remaining_ns);
+            record->data.timer.is_running = data->timer.is_running;
+            record->data.timer.is_expired = data->timer.is_expired;
+            record->data.timer.auto_restart = data->timer.auto_restart;
+            record->data.timer.missed_periods = dop_wire_le32(data->timer.missed_periods);
+            record->data.timer.periods = dop_wire_le64(data->timer.periods);
+            break;
+        default:
+            break;
+    }
+}
+
+// Encoding
+int dop_wire_encode(const dop_component_t* component, dop_wire_record_t* record) {
+    if (!component || !record || component->metadata.type >= DOP_COMPONENT_COUNT) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    dop_component_data_t data;
+    dop_component_read_snapshot(component, &data);
+    dop_wire_pack(record, component, &data, dop_time_monotonic_ns());
+    return DOP_SUCCESS;
+}
+
+size_t dop_wire_serialize(const dop_component_t* component, void* buffer, size_t size) {
+    if (!buffer || size < DOP_WIRE_RECORD_SIZE) return 0;
+
+    dop_wire_record_t record;
+    if (dop_wire_encode(component, &record) != DOP_SUCCESS) return 0;
+
+    memcpy(buffer, &record, DOP_WIRE_RECORD_SIZE);
+    return DOP_WIRE_RECORD_SIZE;
+}
+
+void dop_wire_header_init(dop_wire_header_t* header, uint32_t record_count) {
+    header->magic = dop_wire_le32(DOP_WIRE_MAGIC);
+    header->wire_version = dop_wire_le16(DOP_WIRE_VERSION);
+    header->record_size = dop_wire_le16((uint16_t)DOP_WIRE_RECORD_SIZE);
+    header->record_count = dop_wire_le32(record_count);
+    header->reserved = 0;
+}
+
+// Copies `size` bytes to the iovec cursor, advancing it across segments
+static void wire_scatter(const struct iovec* iov, int* segment, size_t* offset, const void* data, size_t size) {
+    const uint8_t* source = data;
+
+    while (size > 0) {
+        size_t room = iov[*segment].iov_len - *offset;
+        if (room == 0) {
+            (*segment)++;
+            *offset = 0;
+            continue;
+        }
+
+        size_t chunk = size < room ? size : room;
+        memcpy((uint8_t*)iov[*segment].iov_base + *offset, source, chunk);
+        source += chunk;
+        size -= chunk;
+        *offset += chunk;
+    }
+}
+
+size_t dop_wire_serialize_iov(const dop_component_t* const* components, size_t count,
+                              const struct iovec* iov, int iov_count) {
+    if ((!components && count > 0) || !iov || iov_count <= 0 || count > UINT32_MAX) return 0;
+
+    size_t capacity = 0;
+    for (int i = 0; i < iov_count; i++) {
+        capacity += iov[i].iov_len;
+    }
+    if (capacity < DOP_WIRE_STREAM_SIZE(count)) return 0;
+
+    int segment = 0;
+    size_t offset = 0;
+
+    dop_wire_header_t header;
+    dop_wire_header_init(&header, (uint32_t)count);
+    wire_scatter(iov, &segment, &offset, &header, sizeof(header));
+
+    // One monotonic sample for the whole stream
+    uint64_t sampled_ns = dop_time_monotonic_ns();
+    dop_wire_record_t record;
+    dop_component_data_t data;
+
+    for (size_t i = 0; i < count; i++) {
+        if (!components[i] || components[i]->metadata.type >= DOP_COMPONENT_COUNT) return 0;
+        dop_component_read_snapshot(components[i], &data);
+        dop_wire_pack(&record, components[i], &data, sampled_ns);
+        wire_scatter(iov, &segment, &offset, &record, sizeof(record));
+    }
+
+    return DOP_WIRE_STREAM_SIZE(count);
+}
+
+// Zero-Copy Decoding
+const dop_wire_record_t* dop_wire_record_view(const void* buffer, size_t size) {
+    if (!buffer || size < DOP_WIRE_RECORD_SIZE || ((uintptr_t)buffer & 7) != 0) return NULL;
+
+    const dop_wire_record_t* record = buffer;
+    if (record->wire_version != DOP_WIRE_VERSION || record->type >= DOP_COMPONENT_COUNT ||
+        record->id_length > DOP_WIRE_ID_SIZE) {
+        return NULL;
+    }
+    return record;
+}
+
+const dop_wire_record_t* dop_wire_stream_records(const void* buffer, size_t size, uint32_t* record_count) {
+    if (!buffer || size < sizeof(dop_wire_header_t) || ((uintptr_t)buffer & 7) != 0) return NULL;
+
+    const dop_wire_header_t* header = buffer;
+    uint32_t count = dop_wire_le32(header->record_count);
+    if (dop_wire_le32(header->magic) != DOP_WIRE_MAGIC ||
+        dop_wire_le16(header->wire_version) != DOP_WIRE_VERSION ||
+        dop_wire_le16(header->record_size) != DOP_WIRE_RECORD_SIZE ||
+        (size - sizeof(dop_wire_header_t)) / DOP_WIRE_RECORD_SIZE < count) {
+        return NULL;
+    }
+
+    if (record_count) *record_count = count;
+    return (const dop_wire_record_t*)(header + 1);
+}
+
+int dop_wire_decode_data(const dop_wire_record_t* record, dop_component_data_t* data) {
+    if (!record || !data || record->checksum_algorithm > DOP_CHECKSUM_FIELDWISE) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    memset(data, 0, sizeof(dop_component_data_t));
+    switch (record->type) {
+        case DOP_COMPONENT_ALARM:
+            data->alarm.alarm_time = dop_wire_le64(record->data.alarm.alarm_time);
+            data->alarm.current_time = dop_wire_le64(record->data.alarm.current_time);
+            data->alarm.snooze_duration_ms = dop_wire_le32(record->data.alarm.snooze_duration_ms);
+            data->alarm.is_armed = record->data.alarm.is_armed != 0;
+            data->alarm.is_triggered = record->data.alarm.is_triggered != 0;
+            data->alarm.repeat_days = record->data.alarm.repeat_days & DOP_ALARM_REPEAT_DAILY;
+            break;
+        case DOP_COMPONENT_CLOCK:
+            data->clock.current_time = dop_wire_le64(record->data.clock.current_time);
+            data->clock.timezone_offset = (int32_t)dop_wire_le32((uint32_t)record->data.clock.timezone_offset);
+            data->clock.is_running = record->data.clock.is_running != 0;
+            data->clock.is_24_hour_format = record->data.clock.is_24_hour_format != 0;
+            break;
+        case DOP_COMPONENT_STOPWATCH:
+            data->stopwatch.start_time = dop_wire_le64(record->data.stopwatch.start_time);
+            data->stopwatch.current_time = dop_wire_le64(record->data.stopwatch.current_time);
+            data->stopwatch.elapsed_ms = dop_wire_le64(record->data.stopwatch.elapsed_ms);
+            data->stopwatch.start_ns = dop_wire_le64(record->data.stopwatch.start_ns);
+            data->stopwatch.accumulated_ns = dop_wire_le64(record->data.stopwatch.accumulated_ns);
+            data->stopwatch.lap_count = dop_wire_le32(record->data.stopwatch.lap_count);
+            data->stopwatch.is_running = record->data.stopwatch.is_running != 0;
+            data->stopwatch.is_paused = record->data.stopwatch.is_paused != 0;
+            break;
+        case DOP_COMPONENT_TIMER:
+            data->timer.start_time = dop_wire_le64(record->data.timer.start_time);
+            data->timer.start_ns = dop_wire_le64(record->data.timer.start_ns);
+            data->timer.duration_ns = dop_wire_le64(record->data.timer.duration_ns);
+            data->timer.remaining_ns = dop_wire_le64(record->data.timer.remaining_ns);
+            data->timer.is_running = record->data.timer.is_running != 0;
+            data->timer.is_expired = record->data.timer.is_expired != 0;
+            data->timer.auto_restart = record->data.timer.auto_restart != 0;
+            data->timer.missed_periods = dop_wire_le32(record->data.timer.missed_periods);
+            data->timer.periods = dop_wire_le64(record->data.timer.periods);
+            break;
+        default:
+            return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    uint32_t checksum = wire_checksum(record->checksum_algorithm, (dop_component_type_t)record->type, data);
+    if (checksum != dop_wire_le32(record->checksum)) return DOP_ERROR_CHECKSUM_FAILED;
+
+    // Verified; now bind the zone in this process. A zone this host cannot
+    // load keeps its last offset as a fixed one.
+    if (record->type == DOP_COMPONENT_CLOCK) {
+        if (record->data.clock.timezone_kind == DOP_WIRE_TZ_FIXED) {
+            data->clock.timezone_id = DOP_TZ_FIXED;
+        } else if (record->data.clock.timezone_kind == DOP_WIRE_TZ_NAMED) {
+            char zone_name[DOP_TZ_NAME_MAX + 1];
+            memcpy(zone_name, record->data.clock.timezone, DOP_TZ_NAME_MAX);
+            zone_name[DOP_TZ_NAME_MAX] = '\0';
+            uint16_t zone;
+            data->clock.timezone_id = dop_tz_load(zone_name, &zone) == DOP_SUCCESS ? zone : DOP_TZ_FIXED;
+        }
+    }
+    return DOP_SUCCESS;
+}
+
+int dop_wire_apply(const dop_wire_record_t* record, dop_component_t* component) {
+    if (!record || !component || record->type != (uint8_t)component->metadata.type) {
+        return DOP_ERROR_INVALID_PARAMETER;
+    }
+
+    dop_component_data_t data;
+    int result = dop_wire_decode_data(record, &data);
+    if (result != DOP_SUCCESS) return result;
+
+    // Carry running spans over to this host's monotonic clock
+    uint64_t rebase_ns = dop_time_monotonic_ns() - dop_wire_le64(record->sampled_ns);
+    if (record->type == DOP_COMPONENT_STOPWATCH && data.stopwatch.is_running && !data.stopwatch.is_paused) {
+        data.stopwatch.start_ns += rebase_ns;
+    } else if (record->type == DOP_COMPONENT_TIMER && data.timer.is_running) {
+        data.timer.start_ns += rebase_ns;
+    }
+
+    dop_component_write_lock(component);
+    component->data = data;
+    component->checksum = dop_checksum_calculate(component);
+    component->metadata.state = (dop_component_state_t)record->state;
+    component->metadata.last_update_timestamp = dop_wire_le64(record->last_update_timestamp);
+    atomic_store_explicit(&component->metadata.gate_state, (dop_gate_state_t)record->gate, memory_order_release);
+    dop_store_sync_view(component);
+
+    if (record->type == DOP_COMPONENT_TIMER && data.timer.is_running) {
+        dop_timing_wheel_schedule(dop_timing_wheel_default(), component,
+                                  (data.timer.start_ns + data.timer.duration_ns + DOP_NS_PER_MS - 1) / DOP_NS_PER_MS);
+    } else if (dop_timing_wheel_is_scheduled(component)) {
+        dop_timing_wheel_cancel(dop_timing_wheel_default(), component);
+    }
+    if (record->type == DOP_COMPONENT_ALARM && !data.alarm.is_armed) {
+        dop_alarm_index_remove(component);
+    }
+    dop_component_write_unlock(component);
+
+    // Armed alarms re-derive their deadline from the local time of day
+    if (record->type == DOP_COMPONENT_ALARM && data.alarm.is_armed) {
+        dop_alarm_arm(component);
+    }
+
+    return DOP_SUCCESS;
+}
@@ -1,4 +1,29 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "obinexus_dop_core.h"
+#include "dop_component_store.h"
+#include "dop_checksum.h"
+#include "dop_timing_wheel.h"
+#include "dop_event.h"
+#include "dop_slab.h"
+#include "dop_registry.h"
+#include "dop_manifest.h"
+#include "dop_wire.h"
+#include "dop_tick.h"
+#include "dop_scheduler.h"
+#include "dop_deadline.h"
+#include "dop_laps.h"
+#include "dop_alarm_index.h"
+#include "dop_tz.h"
+#include "dop_journal.h"
+#include "dop_snapshot.h"
+#include "dop_time.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sched.h>
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
@@ -42,10 +67,1810 @@ static void test_clock_component(void) {
     printf("Clock component test passed\n");
 }
 
+static void test_component_store(void) {
+    printf("Testing component store...\n");
+    
+    dop_component_store_t* store = dop_store_create();
+    assert(store != NULL);
+    
+    dop_handle_t clock_handle = dop_store_add(store, DOP_COMPONENT_CLOCK);
+    dop_handle_t timer_handle = dop_store_add(store, DOP_COMPONENT_TIMER);
+    assert(clock_handle != DOP_HANDLE_INVALID);
+    assert(DOP_HANDLE_TYPE(timer_handle) == DOP_COMPONENT_TIMER);
+    assert(dop_store_count(store, DOP_COMPONENT_CLOCK) == 1);
+    
+    // Setters on a view write through to the columns
+    dop_component_t* timer = dop_store_view(store, timer_handle);
+    assert(timer != NULL);
+    assert(dop_timer_set_duration(timer, 1500) == DOP_SUCCESS);
+    assert(dop_gate_open(timer) == DOP_SUCCESS);
+    
+    dop_store_shard_t* shard = dop_store_shard(store, timer_handle);
+    assert(shard->span_ns[DOP_HANDLE_SLOT(timer_handle)] == 1500000000ull);
+    assert(shard->gate[DOP_HANDLE_SLOT(timer_handle)] == DOP_GATE_OPEN);
+    
+    // Column changes are visible through a refreshed view
+    shard->flags[DOP_HANDLE_SLOT(timer_handle)] |= DOP_SLOT_EXPIRED;
+    assert(dop_timer_is_expired(dop_store_view(store, timer_handle)) == true);
+    assert(dop_checksum_verify(timer) == true);
+    
+    assert(dop_func_destroy_component(timer) == DOP_SUCCESS);
+    assert(dop_store_contains(store, timer_handle) == false);
+    assert(dop_store_remove(store, clock_handle) == DOP_SUCCESS);
+    assert(dop_store_count(store, DOP_COMPONENT_CLOCK) == 0);
+    
+    dop_store_destroy(store);
+    printf("Component store test passed\n");
+}
+
+static void test_batched_update(void) {
+    printf("Testing batched update...\n");
+    
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handles[3];
+    handles[0] = dop_store_add(store, DOP_COMPONENT_CLOCK);
+    handles[1] = dop_store_add(store, DOP_COMPONENT_TIMER);
+    handles[2] = dop_store_add(store, DOP_COMPONENT_TIMER);
+    
+    for (int i = 0; i < 3; i++) {
+        dop_component_t* view = dop_store_view(store, handles[i]);
+        dop_gate_open(view);
+        if (i > 0) {
+            dop_timer_set_duration(view, i == 1 ? 1 : 100000);
+            dop_timer_start(view);
+        }
+    }
+    
+    // Durations run on the monotonic clock, so wait out the short timer
+    while (dop_timer_remaining_ns(dop_store_view(store, handles[1])) > 0) {
+    }
+    uint64_t now_ms = dop_time_get_current().timestamp_ms;
+    dop_handle_t changed[3];
+    size_t changed_count = 0;
+    assert(dop_func_update_components(store, handles, 3, now_ms, changed, &changed_count) == DOP_SUCCESS);
+    assert(changed_count == 1 && changed[0] == handles[1]);
+    
+    // A setter on a view loaded before the pass keeps the expiry
+    dop_component_t* stale = dop_store_view(store, handles[1]);
+    stale->data.timer.is_expired = false;
+    stale->data.timer.is_running = true;
+    assert(dop_timer_set_auto_restart(stale, true) == DOP_SUCCESS);
+    uint32_t flags = dop_store_shard(store, handles[1])->flags[DOP_HANDLE_SLOT(handles[1])];
+    assert((flags & (DOP_SLOT_EXPIRED | DOP_SLOT_RUNNING | DOP_SLOT_AUTO_RESTART)) ==
+           (DOP_SLOT_EXPIRED | DOP_SLOT_AUTO_RESTART));
+    assert(dop_timer_is_expired(dop_store_view(store, handles[1])) == true);
+    assert(dop_timer_is_expired(dop_store_view(store, handles[2])) == false);
+    assert(dop_store_shard(store, handles[0])->time_ms[DOP_HANDLE_SLOT(handles[0])] == now_ms);
+    
+    dop_store_destroy(store);
+    printf("Batched update test passed\n");
+}
+
+static void test_checksum_algorithms(void) {
+    printf("Testing checksum algorithms...\n");
+    
+    // Standard check values for "123456789"
+    assert(dop_checksum_compute(DOP_CHECKSUM_CRC32, "123456789", 9) == 0xCBF43926u);
+    assert(dop_checksum_compute(DOP_CHECKSUM_CRC32C, "123456789", 9) == 0xE3069283u);
+    assert(dop_checksum_compute_portable(DOP_CHECKSUM_CRC32, "123456789", 9) == 0xCBF43926u);
+    assert(dop_checksum_compute_portable(DOP_CHECKSUM_CRC32C, "123456789", 9) == 0xE3069283u);
+    
+    // The selected backends match slice-by-8 past the 64-byte folding
+    // threshold, from unaligned starts and with odd tails
+    static uint8_t block[1300];
+    for (size_t i = 0; i < sizeof(block); i++) {
+        block[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    static const size_t sizes[] = { 63, 64, 65, 79, 127, 128, 129, 191, 255, 256, 511, 1021, 1280 };
+    for (int algorithm = DOP_CHECKSUM_CRC32; algorithm <= DOP_CHECKSUM_CRC32C; algorithm++) {
+        for (size_t offset = 0; offset < 8; offset++) {
+            for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+                assert(dop_checksum_compute((dop_checksum_algorithm_t)algorithm, block + offset, sizes[i]) ==
+                       dop_checksum_compute_portable((dop_checksum_algorithm_t)algorithm, block + offset, sizes[i]));
+            }
+        }
+    }
+    
+    dop_component_t* stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    assert(stopwatch->checksum_algorithm == DOP_CHECKSUM_FIELDWISE);
+    assert(dop_checksum_verify(stopwatch) == true);
+    
+    // Incremental setter updates match a full recompute
+    assert(dop_stopwatch_start(stopwatch) == DOP_SUCCESS);
+    assert(dop_stopwatch_lap(stopwatch) == DOP_SUCCESS);
+    assert(dop_stopwatch_pause(stopwatch) == DOP_SUCCESS);
+    assert(stopwatch->checksum == dop_checksum_calculate(stopwatch));
+    stopwatch->data.stopwatch.is_paused = false;
+    assert(dop_checksum_verify(stopwatch) == false);
+    stopwatch->data.stopwatch.is_paused = true;
+    
+    // A checksum recorded under another algorithm still verifies
+    stopwatch->checksum_algorithm = DOP_CHECKSUM_CRC32;
+    stopwatch->checksum = dop_checksum_calculate(stopwatch);
+    assert(dop_stopwatch_lap(stopwatch) == DOP_SUCCESS);
+    assert(dop_component_validate_integrity(stopwatch) == DOP_SUCCESS);
+    
+    stopwatch->data.stopwatch.lap_count++;
+    assert(dop_component_validate_integrity(stopwatch) == DOP_ERROR_CHECKSUM_FAILED);
+    
+    dop_func_destroy_component(stopwatch);
+    printf("Checksum algorithms test passed (crc32: %s, crc32c: %s)\n",
+           dop_checksum_backend_name(DOP_CHECKSUM_CRC32),
+           dop_checksum_backend_name(DOP_CHECKSUM_CRC32C));
+}
+
+static void test_gate_bulk(void) {
+    printf("Testing bulk gate transitions...\n");
+    
+    dop_component_t* components[DOP_COMPONENT_COUNT];
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        components[type] = dop_func_create_component((dop_component_type_t)type);
+        assert(dop_gate_is_accessible(components[type]) == false);
+    }
+    
+    assert(dop_gate_set_bulk(components, DOP_COMPONENT_COUNT, DOP_GATE_OPEN) == DOP_SUCCESS);
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        assert(dop_gate_is_accessible(components[type]) == true);
+    }
+    
+    assert(dop_gate_isolate(components[DOP_COMPONENT_TIMER]) == DOP_SUCCESS);
+    assert(dop_gate_is_accessible(components[DOP_COMPONENT_TIMER]) == false);
+    assert(dop_func_update_component(components[DOP_COMPONENT_TIMER]) == DOP_ERROR_INVALID_PARAMETER);
+    
+    assert(dop_gate_set_bulk(components, DOP_COMPONENT_COUNT, (dop_gate_state_t)7) == DOP_ERROR_INVALID_PARAMETER);
+    
+    // Topology opens every node, and a fault test leaves them all open
+    dop_build_topology_t topology = {0};
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        char node_id[32];
+        snprintf(node_id, sizeof(node_id), "node-%d", type);
+        topology.nodes[topology.node_count++] = dop_topology_create_node(node_id, components[type]);
+    }
+    assert(dop_topology_start_p2p_network(&topology) == DOP_SUCCESS);
+    assert(dop_topology_test_fault_tolerance(&topology) == DOP_SUCCESS);
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        assert(dop_gate_is_accessible(components[type]) == true);
+    }
+    
+    // A node already down fails the test for every other node
+    dop_gate_close(components[DOP_COMPONENT_CLOCK]);
+    assert(dop_topology_test_fault_tolerance(&topology) == DOP_ERROR_TOPOLOGY_FAULT);
+    assert(dop_gate_is_accessible(components[DOP_COMPONENT_CLOCK]) == false);
+    
+    for (int type = 0; type < DOP_COMPONENT_COUNT; type++) {
+        free(topology.nodes[type]);
+        dop_func_destroy_component(components[type]);
+    }
+    printf("Bulk gate transitions test passed\n");
+}
+
+typedef struct {
+    dop_component_t* alarm;
+    _Atomic(bool) stop;
+} seqlock_writer_t;
+
+static void* write_alarm_settings(void* context) {
+    seqlock_writer_t* writer = context;
+    for (uint64_t i = 1; !atomic_load_explicit(&writer->stop, memory_order_relaxed); i++) {
+        dop_alarm_set_time(writer->alarm, dop_time_from_ms(i * 1234567ull));
+        dop_alarm_snooze(writer->alarm, (uint32_t)i);
+    }
+    return NULL;
+}
+
+static void test_seqlock_readers(void) {
+    printf("Testing seqlock readers...\n");
+    
+    dop_component_t* alarm = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_gate_open(alarm);
+    dop_alarm_snooze(alarm, 0);
+    seqlock_writer_t writer = { .alarm = alarm };
+    pthread_t thread;
+    assert(pthread_create(&thread, NULL, write_alarm_settings, &writer) == 0);
+    
+    // Every consistent read matches its checksum; a torn one would not.
+    // Both are read between begin and retry, which also keeps the copy
+    // out of ThreadSanitizer's race reports.
+    // The writer sets the time before the snooze, so no snapshot sees a
+    // snooze ahead of its time.
+    // Yielding mid-copy lets writes land inside the read even on one CPU.
+    size_t retries = 0;
+    for (int i = 0; i < 500; i++) {
+        dop_component_data_t data;
+        uint32_t checksum;
+        uint32_t sequence;
+        for (;;) {
+            sequence = dop_component_read_begin(alarm);
+            checksum = alarm->checksum;
+            sched_yield();
+            memcpy(&data, &alarm->data, sizeof(data));
+            if (!dop_component_read_retry(alarm, sequence)) break;
+            retries++;
+        }
+        assert(checksum == dop_checksum_compute((dop_checksum_algorithm_t)alarm->checksum_algorithm,
+                                                &data, sizeof(data)));
+        
+        dop_component_data_t snapshot;
+        dop_component_read_snapshot(alarm, &snapshot);
+        assert(snapshot.alarm.alarm_time >= snapshot.alarm.snooze_duration_ms * 1234567ull);
+    }
+    atomic_store_explicit(&writer.stop, true, memory_order_relaxed);
+    pthread_join(thread, NULL);
+    
+    assert(dop_checksum_verify(alarm));
+    dop_func_destroy_component(alarm);
+    printf("Seqlock readers test passed (%zu retries)\n", retries);
+}
+
+static void test_cold_metadata(void) {
+    printf("Testing cold metadata...\n");
+    
+    dop_component_t* first = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    dop_component_t* second = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    assert(((uintptr_t)first % DOP_CACHE_LINE) == 0);
+    assert(sizeof(dop_component_t) <= 2 * DOP_CACHE_LINE);
+    
+    // Names and versions are interned, identities are per component
+    assert(strcmp(dop_component_name(first), "Clock Component") == 0);
+    assert(dop_component_name(first) == dop_component_name(second));
+    assert(dop_component_version(first) == dop_component_version(second));
+    assert(dop_component_creation_timestamp(first) > 0);
+    
+    assert(dop_component_set_id(second, "clock_b") == DOP_SUCCESS);
+    assert(strcmp(dop_component_id(second), "clock_b") == 0);
+    assert(strcmp(dop_component_id(first), "clock_b") != 0);
+    assert(dop_component_set_name(first, "Wall Clock") == DOP_SUCCESS);
+    assert(strcmp(dop_component_name(first), "Wall Clock") == 0);
+    assert(strcmp(dop_component_name(second), "Clock Component") == 0);
+    
+    dop_func_destroy_component(first);
+    dop_func_destroy_component(second);
+    printf("Cold metadata test passed\n");
+}
+
+static void test_slab_lifecycle(void) {
+    printf("Testing slab lifecycle...\n");
+    
+    dop_slab_stats_t before;
+    assert(dop_slab_get_stats(DOP_COMPONENT_STOPWATCH, &before) == DOP_SUCCESS);
+    
+    dop_component_t* components[100];
+    assert(dop_func_create_components(DOP_COMPONENT_STOPWATCH, components, 100) == 100);
+    for (int i = 0; i < 100; i++) {
+        assert(((uintptr_t)components[i] % DOP_CACHE_LINE) == 0);
+        assert(dop_checksum_verify(components[i]));
+        assert(strcmp(dop_component_name(components[i]), "Stopwatch Component") == 0);
+    }
+    // Cold slots are per component even though initialization was shared
+    assert(components[0]->metadata.cold_index != components[99]->metadata.cold_index);
+    assert(dop_stopwatch_start(components[42]) == DOP_SUCCESS);
+    assert(components[41]->data.stopwatch.is_running == false);
+    
+    dop_slab_stats_t during;
+    dop_slab_get_stats(DOP_COMPONENT_STOPWATCH, &during);
+    assert(during.live == before.live + 100);
+    assert(during.peak >= during.live && during.capacity >= during.live);
+    
+    dop_func_destroy_components(components, 100);
+    dop_slab_stats_t after;
+    dop_slab_get_stats(DOP_COMPONENT_STOPWATCH, &after);
+    assert(after.live == before.live);
+    assert(after.peak == during.peak);
+    
+    // Freed objects are reused rather than backed by new slabs
+    dop_component_t* reused = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    dop_slab_get_stats(DOP_COMPONENT_STOPWATCH, &after);
+    assert(reused && after.capacity == during.capacity);
+    dop_func_destroy_component(reused);
+    printf("Slab lifecycle test passed\n");
+}
+
+static void* rename_component(void* context) {
+    dop_component_t* component = context;
+    for (int i = 0; i < 2000; i++) {
+        dop_component_set_id(component, (i & 1) ? "pantry_timer" : "kitchen_timer");
+    }
+    return NULL;
+}
+
+static void test_component_registry(void) {
+    printf("Testing component registry...\n");
+    
+    // Same type, same second: IDs are still distinct and resolvable
+    dop_component_t* first = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_component_t* second = dop_func_create_component(DOP_COMPONENT_TIMER);
+    assert(strcmp(dop_component_id(first), dop_component_id(second)) != 0);
+    assert(dop_registry_lookup(dop_component_id(first)) == first);
+    assert(dop_registry_lookup(dop_component_id(second)) == second);
+    assert(dop_registry_lookup("no_such_component") == NULL);
+    
+    // Explicit IDs rebind; taking another component's ID is refused
+    assert(dop_component_set_id(first, "kitchen_timer") == DOP_SUCCESS);
+    assert(dop_registry_lookup("kitchen_timer") == first);
+    assert(dop_component_set_id(second, "kitchen_timer") == DOP_ERROR_INVALID_STATE);
+    assert(dop_registry_lookup(dop_component_id(second)) == second);
+    
+    // Lookups racing a rebind see the component under either ID, or neither
+    pthread_t renamer;
+    assert(pthread_create(&renamer, NULL, rename_component, first) == 0);
+    for (int i = 0; i < 20000; i++) {
+        dop_component_t* found = dop_registry_lookup((i & 1) ? "pantry_timer" : "kitchen_timer");
+        assert(found == NULL || found == first);
+    }
+    pthread_join(renamer, NULL);
+    assert(dop_registry_lookup("pantry_timer") == first);
+    assert(dop_component_set_id(first, "kitchen_timer") == DOP_SUCCESS);
+    
+    // Batched components get their own IDs and the template none; destroy unregisters
+    dop_component_t* batch[300];
+    size_t before = dop_registry_count();
+    uint64_t serial = dop_registry_next_serial();
+    assert(dop_func_create_components(DOP_COMPONENT_ALARM, batch, 300) == 300);
+    assert(dop_registry_count() == before + 300);
+    assert(dop_registry_next_serial() == serial + 301);
+    for (int i = 0; i < 300; i++) {
+        assert(dop_registry_lookup(dop_component_id(batch[i])) == batch[i]);
+    }
+    char batch_id[64];
+    snprintf(batch_id, sizeof(batch_id), "%s", dop_component_id(batch[7]));
+    dop_func_destroy_components(batch, 300);
+    assert(dop_registry_count() == before);
+    assert(dop_registry_lookup(batch_id) == NULL);
+    
+    // Store views resolve to their handle
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handle = dop_store_add(store, DOP_COMPONENT_CLOCK);
+    dop_component_t* view = dop_store_view(store, handle);
+    assert(dop_registry_resolve(dop_component_id(view)) == handle);
+    assert(dop_registry_resolve("kitchen_timer") == DOP_HANDLE_INVALID);
+    dop_store_destroy(store);
+    
+    // Manifest component_ref entries rebind to live components
+    dop_build_topology_t topology = {0};
+    strncpy(topology.build_id, "registry_manifest", sizeof(topology.build_id) - 1);
+    dop_topology_node_t* node = dop_topology_create_node("node_timer", first);
+    topology.nodes[topology.node_count++] = node;
+    assert(dop_manifest_save_to_xml(&topology, "test_registry_manifest.xml") == DOP_SUCCESS);
+    dop_build_topology_t loaded = {0};
+    assert(dop_manifest_load_from_xml("test_registry_manifest.xml", &loaded) == DOP_SUCCESS);
+    assert(loaded.node_count == 1 && loaded.nodes[0]->component == first);
+    assert(strcmp(loaded.nodes[0]->node_id, "node_timer") == 0);
+    remove("test_registry_manifest.xml");
+    free(loaded.nodes[0]);
+    free(node);
+    
+    dop_func_destroy_component(first);
+    dop_func_destroy_component(second);
+    assert(dop_registry_lookup("kitchen_timer") == NULL);
+    printf("Component registry test passed\n");
+}
+
+static void test_wire_format(void) {
+    printf("Testing wire format...\n");
+    
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_timer_set_duration(timer, 60000);
+    dop_timer_start(timer);
+    
+    // Single record, read in place
+    _Alignas(8) uint8_t buffer[DOP_WIRE_STREAM_SIZE(3)];
+    assert(dop_wire_serialize(timer, buffer, DOP_WIRE_RECORD_SIZE - 1) == 0);
+    assert(dop_wire_serialize(timer, buffer, sizeof(buffer)) == DOP_WIRE_RECORD_SIZE);
+    const dop_wire_record_t* record = dop_wire_record_view(buffer, sizeof(buffer));
+    assert(record && record->type == DOP_COMPONENT_TIMER && record->data.timer.is_running);
+    assert(dop_wire_le64(record->data.timer.duration_ns) == 60000000000ull);
+    assert(record->id_length == strlen(dop_component_id(timer)));
+    assert(memcmp(record->component_id, dop_component_id(timer), record->id_length) == 0);
+    
+    // Applying keeps the running timer's progress
+    dop_component_t* replica = dop_func_create_component(DOP_COMPONENT_TIMER);
+    assert(dop_wire_apply(record, replica) == DOP_SUCCESS);
+    assert(dop_checksum_verify(replica));
+    assert(replica->data.timer.is_running && dop_timing_wheel_is_scheduled(replica));
+    uint64_t remaining = dop_timer_remaining_ns(replica);
+    assert(remaining > 59000000000ull && remaining <= 60000000000ull);
+    
+    dop_component_t* clock = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    assert(dop_wire_apply(record, clock) == DOP_ERROR_INVALID_PARAMETER);
+    buffer[40] ^= 0x01;
+    assert(dop_wire_apply(record, replica) == DOP_ERROR_CHECKSUM_FAILED);
+    
+    // A stream split across uneven iovec segments reassembles in place
+    const dop_component_t* components[3] = { timer, clock, replica };
+    struct iovec iov[2] = {
+        { .iov_base = buffer, .iov_len = 100 },
+        { .iov_base = buffer + 100, .iov_len = sizeof(buffer) - 100 },
+    };
+    assert(dop_wire_serialize_iov(components, 3, iov, 1) == 0);
+    assert(dop_wire_serialize_iov(components, 3, iov, 2) == DOP_WIRE_STREAM_SIZE(3));
+    uint32_t record_count = 0;
+    const dop_wire_record_t* records = dop_wire_stream_records(buffer, sizeof(buffer), &record_count);
+    assert(records && record_count == 3);
+    assert(records[1].type == DOP_COMPONENT_CLOCK && records[2].type == DOP_COMPONENT_TIMER);
+    dop_component_data_t data;
+    assert(dop_wire_decode_data(&records[1], &data) == DOP_SUCCESS);
+    assert(data.clock.is_24_hour_format);
+    
+    // Whole store in one pass
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handles[3] = {
+        dop_store_add(store, DOP_COMPONENT_ALARM),
+        dop_store_add(store, DOP_COMPONENT_CLOCK),
+        dop_store_add(store, DOP_COMPONENT_CLOCK),
+    };
+    assert(dop_store_serialize(store, buffer, DOP_WIRE_STREAM_SIZE(2)) == 0);
+    assert(dop_store_serialize(store, buffer, sizeof(buffer)) == DOP_WIRE_STREAM_SIZE(3));
+    records = dop_wire_stream_records(buffer, sizeof(buffer), &record_count);
+    assert(records && record_count == 3);
+    for (uint32_t i = 0; i < record_count; i++) {
+        assert(dop_wire_le32(records[i].handle) == handles[i]);
+        assert(dop_wire_decode_data(&records[i], &data) == DOP_SUCCESS);
+    }
+    dop_store_destroy(store);
+    
+    dop_func_destroy_component(timer);
+    dop_func_destroy_component(replica);
+    dop_func_destroy_component(clock);
+    printf("Wire format test passed\n");
+}
+
+static void test_clock_formatting(void) {
+    printf("Testing clock formatting...\n");
+    
+    dop_component_t* clock = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    dop_time_data_t expanded = dop_time_to_data(dop_time_now());
+    expanded.hours = 13;
+    expanded.minutes = 5;
+    expanded.seconds = 9;
+    expanded.milliseconds = 7;
+    clock->data.clock.current_time = dop_time_from_data(expanded);
+    
+    char text[DOP_CLOCK_FORMAT_SIZE];
+    assert(dop_clock_format_time_into(clock, text, sizeof(text)) == 12);
+    assert(strcmp(text, "13:05:09.007") == 0);
+    assert(dop_clock_format_time_into(clock, text, 12) == 0);
+    assert(dop_clock_format_time_into(clock, text, 13) == 12);
+    
+    dop_clock_set_format(clock, false);
+    assert(dop_clock_format_time_into(clock, text, sizeof(text)) == 14);
+    assert(strcmp(text, "1:05:09.007 PM") == 0);
+    clock->data.clock.current_time -= 13 * 3600000ull;
+    dop_clock_format_time_into(clock, text, sizeof(text));
+    assert(strcmp(text, "12:05:09.007 AM") == 0);
+    clock->data.clock.current_time += 10 * 3600000ull + 999;
+    dop_clock_format_time_into(clock, text, sizeof(text));
+    assert(strcmp(text, "10:05:10.006 AM") == 0);
+    
+    // Batch output matches snprintf across many seconds and both forms
+    enum { CLOCKS = 256, STRIDE = 16 };
+    dop_component_t* clocks[CLOCKS];
+    assert(dop_func_create_components(DOP_COMPONENT_CLOCK, clocks, CLOCKS) == CLOCKS);
+    dop_time_t base = dop_time_now();
+    for (int i = 0; i < CLOCKS; i++) {
+        clocks[i]->data.clock.current_time = base + (dop_time_t)i * 7919;
+        clocks[i]->data.clock.is_24_hour_format = (i % 3) != 0;
+    }
+    
+    // A non-clock entry renders as ""
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    const dop_component_t* sources[CLOCKS];
+    for (int i = 0; i < CLOCKS; i++) {
+        sources[i] = i == 5 ? timer : clocks[i];
+    }
+    char batch[CLOCKS * STRIDE];
+    assert(dop_clock_format_batch(sources, CLOCKS, batch, STRIDE) == CLOCKS - 1);
+    for (int i = 0; i < CLOCKS; i++) {
+        if (i == 5) {
+            assert(batch[i * STRIDE] == '\0');
+            continue;
+        }
+        char expected[32];
+        dop_time_data_t t = dop_time_to_data(clocks[i]->data.clock.current_time);
+        if (clocks[i]->data.clock.is_24_hour_format) {
+            snprintf(expected, sizeof(expected), "%02u:%02u:%02u.%03u", t.hours, t.minutes, t.seconds, t.milliseconds);
+        } else {
+            snprintf(expected, sizeof(expected), "%u:%02u:%02u.%03u %s", t.hours % 12 ? t.hours % 12 : 12,
+                     t.minutes, t.seconds, t.milliseconds, t.hours >= 12 ? "PM" : "AM");
+        }
+        assert(strcmp(&batch[i * STRIDE], expected) == 0);
+    }
+    
+    char* legacy = dop_clock_format_time(clock);
+    assert(legacy && strcmp(legacy, "10:05:10.006 AM") == 0);
+    free(legacy);
+    
+    dop_func_destroy_components(clocks, CLOCKS);
+    dop_func_destroy_component(timer);
+    dop_func_destroy_component(clock);
+    printf("Clock formatting test passed\n");
+}
+
+static void test_tick_engine(void) {
+    printf("Testing tick engine...\n");
+    
+    dop_tick_engine_t* engine = dop_tick_engine_create(2, 1000);
+    assert(engine && dop_tick_engine_shard_count(engine) == 2);
+    
+    // Components spread over the least loaded shards
+    dop_component_t* clocks[8];
+    assert(dop_func_create_components(DOP_COMPONENT_CLOCK, clocks, 8) == 8);
+    dop_gate_set_bulk(clocks, 8, DOP_GATE_OPEN);
+    for (int i = 0; i < 8; i++) {
+        clocks[i]->data.clock.current_time = 0;
+        assert(dop_tick_engine_add(engine, clocks[i], NULL) == DOP_SUCCESS);
+    }
+    dop_tick_shard_stats_t stats[2];
+    dop_tick_engine_shard_stats(engine, 0, &stats[0]);
+    dop_tick_engine_shard_stats(engine, 1, &stats[1]);
+    assert(stats[0].component_count == 4 && stats[1].component_count == 4);
+    
+    // Topology nodes map onto shards round-robin
+    dop_component_t* alarm = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_component_t* stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    dop_build_topology_t topology = {0};
+    topology.nodes[topology.node_count++] = dop_topology_create_node("node_a", alarm);
+    topology.nodes[topology.node_count++] = dop_topology_create_node("node_b", timer);
+    topology.nodes[topology.node_count++] = dop_topology_create_node("node_c", stopwatch);
+    assert(dop_tick_engine_attach_topology(engine, &topology) == DOP_SUCCESS);
+    
+    // Store shards are ticked by the workers too
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handle = dop_store_add(store, DOP_COMPONENT_TIMER);
+    dop_component_t* view = dop_store_view(store, handle);
+    dop_gate_open(view);
+    dop_timer_set_duration(view, 1);
+    dop_timer_start(view);
+    assert(dop_tick_engine_attach_store(engine, store) == DOP_SUCCESS);
+    
+    assert(dop_tick_engine_start(engine) == DOP_SUCCESS);
+    assert(dop_tick_engine_is_running(engine));
+    assert(dop_tick_engine_start(engine) == DOP_ERROR_INVALID_STATE);
+    assert(dop_tick_engine_attach_store(engine, NULL) == DOP_ERROR_INVALID_STATE);
+    assert(pthread_equal(topology.nodes[0]->worker_thread, topology.nodes[2]->worker_thread));
+    assert(!pthread_equal(topology.nodes[0]->worker_thread, topology.nodes[1]->worker_thread));
+    
+    do {
+        poll(NULL, 0, 2);
+        dop_tick_engine_shard_stats(engine, 0, &stats[0]);
+        dop_tick_engine_shard_stats(engine, 1, &stats[1]);
+    } while (stats[0].ticks < 3 || stats[1].ticks < 3);
+    
+    // Shards added while the workers run are published to them whole
+    for (uint32_t i = 0; i <= DOP_STORE_SHARD_CAPACITY; i++) {
+        assert(dop_store_add(store, DOP_COMPONENT_CLOCK) != DOP_HANDLE_INVALID);
+    }
+    assert(dop_store_shard_count(store, DOP_COMPONENT_CLOCK) == 2);
+    uint64_t seen = stats[1].ticks;
+    do {
+        poll(NULL, 0, 2);
+        dop_tick_engine_shard_stats(engine, 1, &stats[1]);
+    } while (stats[1].ticks < seen + 2);
+    assert(dop_tick_engine_set_rate(engine, 500) == DOP_SUCCESS);
+    // Periods shorter than a nanosecond are rejected
+    assert(dop_tick_engine_set_rate(engine, DOP_TICK_MAX_HZ + 1) == DOP_ERROR_INVALID_PARAMETER);
+    assert(dop_tick_engine_create(1, DOP_TICK_MAX_HZ + 1) == NULL);
+    
+    // Drain leaves every component updated by a final pass
+    assert(dop_tick_engine_drain(engine) == DOP_SUCCESS);
+    assert(!dop_tick_engine_is_running(engine));
+    for (int i = 0; i < 8; i++) {
+        assert(clocks[i]->data.clock.current_time > 0);
+    }
+    view = dop_store_view(store, handle);
+    assert(view->data.timer.is_expired);
+    assert(dop_tick_engine_stop(engine) == DOP_SUCCESS);
+    
+    // Restart, then stop without a final pass
+    assert(dop_tick_engine_remove(engine, clocks[0]) == DOP_SUCCESS);
+    assert(dop_tick_engine_remove(engine, clocks[0]) == DOP_ERROR_INVALID_PARAMETER);
+    assert(dop_tick_engine_start(engine) == DOP_SUCCESS);
+    assert(dop_tick_engine_stop(engine) == DOP_SUCCESS);
+    
+    dop_tick_engine_destroy(engine);
+    dop_store_destroy(store);
+    for (uint32_t i = 0; i < topology.node_count; i++) {
+        free(topology.nodes[i]);
+    }
+    dop_func_destroy_components(clocks, 8);
+    dop_func_destroy_component(alarm);
+    dop_func_destroy_component(timer);
+    dop_func_destroy_component(stopwatch);
+    printf("Tick engine test passed\n");
+}
+
+static void sum_indices(dop_component_t* const* components, size_t begin, size_t end, void* context) {
+    (void)components;
+    size_t local = 0;
+    for (size_t i = begin; i < end; i++) {
+        local += i;
+    }
+    __atomic_fetch_add((size_t*)context, local, __ATOMIC_RELAXED);
+}
+
+static void test_work_stealing_scheduler(void) {
+    printf("Testing work-stealing scheduler...\n");
+    
+    dop_scheduler_t* scheduler = dop_scheduler_create(4);
+    assert(scheduler && dop_scheduler_worker_count(scheduler) == 4);
+    
+    enum { COUNT = 1000 };
+    dop_component_t* clocks[COUNT];
+    assert(dop_func_create_components(DOP_COMPONENT_CLOCK, clocks, COUNT) == COUNT);
+    
+    // Every index is visited exactly once, whatever the split
+    size_t sum = 0;
+    assert(dop_parallel_for(scheduler, clocks, COUNT, 1, sum_indices, &sum) == DOP_SUCCESS);
+    assert(sum == (size_t)COUNT * (COUNT - 1) / 2);
+    assert(dop_parallel_for(scheduler, clocks, 0, 0, sum_indices, &sum) == DOP_SUCCESS);
+    assert(dop_parallel_for(scheduler, clocks, COUNT, 0, NULL, NULL) == DOP_ERROR_INVALID_PARAMETER);
+    
+    uint64_t ranges = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        dop_scheduler_worker_stats_t stats;
+        assert(dop_scheduler_worker_stats(scheduler, i, &stats) == DOP_SUCCESS);
+        ranges += stats.ranges;
+    }
+    assert(ranges == COUNT);
+    
+    // Update skips closed gates
+    for (int i = 0; i < COUNT; i += 2) {
+        dop_gate_open(clocks[i]);
+    }
+    uint32_t closed_checksum = clocks[1]->checksum;
+    size_t updated = 0;
+    assert(dop_parallel_update(scheduler, clocks, COUNT, &updated) == DOP_SUCCESS);
+    assert(updated == COUNT / 2);
+    assert(clocks[1]->checksum == closed_checksum);
+    
+    size_t failed = 0;
+    assert(dop_parallel_validate(scheduler, clocks, COUNT, &failed) == DOP_SUCCESS && failed == 0);
+    clocks[777]->checksum ^= 1;
+    assert(dop_parallel_validate(scheduler, clocks, COUNT, &failed) == DOP_ERROR_CHECKSUM_FAILED);
+    assert(failed == 1);
+    clocks[777]->checksum ^= 1;
+    
+    // Serialized records land at their component's index
+    size_t size = DOP_WIRE_STREAM_SIZE(COUNT);
+    void* stream = malloc(size);
+    assert(dop_parallel_serialize(scheduler, clocks, COUNT, stream, size - 1) == 0);
+    assert(dop_parallel_serialize(scheduler, clocks, COUNT, stream, size) == size);
+    uint32_t record_count = 0;
+    const dop_wire_record_t* records = dop_wire_stream_records(stream, size, &record_count);
+    assert(records && record_count == COUNT);
+    for (int i = 0; i < COUNT; i += 111) {
+        dop_component_data_t data;
+        assert(dop_wire_decode_data(&records[i], &data) == DOP_SUCCESS);
+        assert(data.clock.current_time == clocks[i]->data.clock.current_time);
+        assert(strncmp(records[i].component_id, dop_component_id(clocks[i]), DOP_WIRE_ID_SIZE) == 0);
+    }
+    free(stream);
+    
+    // A single worker runs the loop inline
+    dop_scheduler_t* inline_scheduler = dop_scheduler_create(1);
+    sum = 0;
+    assert(dop_parallel_for(inline_scheduler, clocks, COUNT, 16, sum_indices, &sum) == DOP_SUCCESS);
+    assert(sum == (size_t)COUNT * (COUNT - 1) / 2);
+    dop_scheduler_destroy(inline_scheduler);
+    
+    dop_scheduler_destroy(scheduler);
+    dop_func_destroy_components(clocks, COUNT);
+    printf("Work-stealing scheduler test passed\n");
+}
+
+static void test_deadline_scheduler(void) {
+    printf("Testing deadline scheduler...\n");
+    
+    dop_deadline_scheduler_t* scheduler = dop_deadline_scheduler_create();
+    assert(scheduler);
+    assert(dop_deadline_set_refresh(scheduler, DOP_COMPONENT_TIMER, 1) == DOP_ERROR_INVALID_PARAMETER);
+    assert(dop_deadline_set_refresh(scheduler, DOP_COMPONENT_CLOCK, 0) == DOP_SUCCESS);
+    
+    // Idle components are tracked but never queued
+    enum { IDLE_COUNT = 100 };
+    dop_component_t* idle[IDLE_COUNT];
+    assert(dop_func_create_components(DOP_COMPONENT_STOPWATCH, idle, IDLE_COUNT) == IDLE_COUNT);
+    dop_gate_set_bulk(idle, IDLE_COUNT, DOP_GATE_OPEN);
+    uint32_t idle_sequence[IDLE_COUNT];
+    for (int i = 0; i < IDLE_COUNT; i++) {
+        assert(dop_deadline_add(scheduler, idle[i]) == DOP_SUCCESS);
+        idle_sequence[i] = idle[i]->sequence;
+    }
+    assert(dop_deadline_add(scheduler, idle[0]) == DOP_ERROR_INVALID_STATE);
+    assert(dop_deadline_next(scheduler) == DOP_DEADLINE_IDLE);
+    
+    // Active components: a running stopwatch, a timer and a snoozed alarm
+    dop_component_t* stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_component_t* alarm = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_component_t* clock = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    dop_gate_open(stopwatch);
+    dop_gate_open(timer);
+    dop_gate_open(alarm);
+    dop_gate_open(clock);
+    dop_stopwatch_start(stopwatch);
+    dop_timer_set_duration(timer, 5);
+    dop_timer_start(timer);
+    dop_alarm_arm(alarm);
+    dop_alarm_snooze(alarm, 5);
+    assert(dop_deadline_add(scheduler, stopwatch) == DOP_SUCCESS);
+    assert(dop_deadline_add(scheduler, timer) == DOP_SUCCESS);
+    assert(dop_deadline_add(scheduler, alarm) == DOP_SUCCESS);
+    assert(dop_deadline_add(scheduler, clock) == DOP_SUCCESS);
+    assert(dop_deadline_of(scheduler, timer) == timer->data.timer.start_ns + timer->data.timer.duration_ns);
+    assert(dop_deadline_of(scheduler, clock) == DOP_DEADLINE_IDLE);
+    
+    dop_deadline_stats_t stats;
+    dop_deadline_get_stats(scheduler, &stats);
+    assert(stats.tracked == IDLE_COUNT + 4 && stats.scheduled == 3);
+    
+    // Due passes expire the timer and fire the alarm, then both go idle
+    for (int i = 0; i < 100 && !(dop_timer_is_expired(timer) && dop_alarm_is_triggered(alarm)); i++) {
+        assert(dop_deadline_run_once(scheduler, 50, NULL) == DOP_SUCCESS);
+    }
+    assert(dop_timer_is_expired(timer) && dop_alarm_is_triggered(alarm));
+    assert(dop_deadline_of(scheduler, timer) == DOP_DEADLINE_IDLE);
+    assert(dop_deadline_of(scheduler, alarm) == DOP_DEADLINE_IDLE);
+    
+    // The running stopwatch keeps refreshing
+    for (int i = 0; i < 100 && stopwatch->data.stopwatch.elapsed_ms == 0; i++) {
+        assert(dop_deadline_run_once(scheduler, 50, NULL) == DOP_SUCCESS);
+    }
+    assert(stopwatch->data.stopwatch.elapsed_ms > 0);
+    for (int i = 0; i < IDLE_COUNT; i++) {
+        assert(idle[i]->sequence == idle_sequence[i]);
+    }
+    
+    // Pausing takes effect once touched; nothing is left to wait for
+    dop_stopwatch_pause(stopwatch);
+    assert(dop_deadline_touch(scheduler, stopwatch) == DOP_SUCCESS);
+    assert(dop_deadline_next(scheduler) == DOP_DEADLINE_IDLE);
+    size_t updated = 1;
+    assert(dop_deadline_run_once(scheduler, 0, &updated) == DOP_SUCCESS && updated == 0);
+    
+    // The heap always surfaces the earliest deadline
+    enum { TIMER_COUNT = 50 };
+    dop_component_t* timers[TIMER_COUNT];
+    assert(dop_func_create_components(DOP_COMPONENT_TIMER, timers, TIMER_COUNT) == TIMER_COUNT);
+    dop_gate_set_bulk(timers, TIMER_COUNT, DOP_GATE_OPEN);
+    for (int i = 0; i < TIMER_COUNT; i++) {
+        dop_timer_set_duration(timers[i], 1000 + (uint64_t)(i * 37 % TIMER_COUNT) * 1000);
+        dop_timer_start(timers[i]);
+        assert(dop_deadline_add(scheduler, timers[i]) == DOP_SUCCESS);
+    }
+    for (int removed = 0; removed < TIMER_COUNT; removed++) {
+        uint64_t next = dop_deadline_next(scheduler);
+        dop_component_t* earliest = NULL;
+        for (int i = 0; i < TIMER_COUNT; i++) {
+            if (timers[i] && (!earliest || dop_deadline_of(scheduler, timers[i]) < dop_deadline_of(scheduler, earliest))) {
+                earliest = timers[i];
+            }
+        }
+        assert(next == dop_deadline_of(scheduler, earliest));
+        assert(dop_deadline_remove(scheduler, earliest) == DOP_SUCCESS);
+        for (int i = 0; i < TIMER_COUNT; i++) {
+            if (timers[i] == earliest) timers[i] = NULL;
+        }
+    }
+    assert(dop_deadline_remove(scheduler, stopwatch) == DOP_SUCCESS);
+    assert(dop_deadline_remove(scheduler, stopwatch) == DOP_ERROR_INVALID_PARAMETER);
+    assert(dop_deadline_touch(scheduler, stopwatch) == DOP_ERROR_INVALID_PARAMETER);
+    for (int i = 0; i < IDLE_COUNT; i++) {
+        assert(dop_deadline_remove(scheduler, idle[i]) == DOP_SUCCESS);
+    }
+    dop_deadline_get_stats(scheduler, &stats);
+    assert(stats.tracked == 3 && stats.scheduled == 0 && stats.updates > 0);
+    
+    dop_deadline_scheduler_destroy(scheduler);
+    dop_func_destroy_components(idle, IDLE_COUNT);
+    dop_func_destroy_component(stopwatch);
+    dop_func_destroy_component(timer);
+    dop_func_destroy_component(alarm);
+    dop_func_destroy_component(clock);
+    printf("Deadline scheduler test passed\n");
+}
+
+static void test_lap_history(void) {
+    printf("Testing stopwatch lap history...\n");
+    
+    dop_component_t* stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    assert(stopwatch);
+    dop_gate_open(stopwatch);
+    
+    // Without a history, laps are only counted
+    dop_lap_view_t view;
+    dop_lap_stats_t stats;
+    assert(dop_stopwatch_lap_view(stopwatch, &view) == DOP_SUCCESS);
+    assert(view.first_count == 0 && view.second_count == 0);
+    assert(dop_stopwatch_set_lap_history(stopwatch, DOP_LAP_MAX_DEPTH + 1, DOP_LAP_OVERWRITE_OLDEST) ==
+           DOP_ERROR_INVALID_PARAMETER);
+    
+    // Overwrite-oldest keeps the newest laps, wrapping around the ring
+    assert(dop_stopwatch_set_lap_history(stopwatch, 3, DOP_LAP_OVERWRITE_OLDEST) == DOP_SUCCESS);
+    dop_stopwatch_start(stopwatch);
+    for (int i = 0; i < 5; i++) {
+        poll(NULL, 0, 1 + i % 2);
+        dop_stopwatch_lap(stopwatch);
+    }
+    assert(stopwatch->data.stopwatch.lap_count == 5);
+    assert(dop_stopwatch_lap_stats(stopwatch, &stats) == DOP_SUCCESS);
+    assert(stats.count == 3 && stats.recorded == 5 && stats.dropped == 2);
+    assert(dop_stopwatch_lap_view(stopwatch, &view) == DOP_SUCCESS);
+    assert(view.first_count + view.second_count == 3 && view.second_count > 0);
+    
+    uint64_t laps[3];
+    uint64_t sum = 0;
+    for (size_t i = 0; i < 3; i++) {
+        const dop_lap_t* lap = dop_lap_view_at(&view, i);
+        laps[i] = lap->lap_ns;
+        sum += lap->lap_ns;
+        assert(lap->lap_ns >= 1000000);
+        if (i > 0) assert(lap->split_ns == dop_lap_view_at(&view, i - 1)->split_ns + lap->lap_ns);
+    }
+    assert(stats.mean_ns == sum / 3);
+    
+    uint64_t sorted[3] = {laps[0], laps[1], laps[2]};
+    for (int i = 0; i < 3; i++) {
+        for (int j = i + 1; j < 3; j++) {
+            if (sorted[j] < sorted[i]) {
+                uint64_t swap = sorted[i];
+                sorted[i] = sorted[j];
+                sorted[j] = swap;
+            }
+        }
+    }
+    assert(stats.min_ns == sorted[0] && stats.max_ns == sorted[2]);
+    assert(dop_stopwatch_lap_percentile(stopwatch, 0.0) == sorted[0]);
+    assert(dop_stopwatch_lap_percentile(stopwatch, 50.0) == sorted[1]);
+    assert(dop_stopwatch_lap_percentile(stopwatch, 100.0) == sorted[2]);
+    
+    // Drop-newest keeps the first laps; reset clears the history
+    assert(dop_stopwatch_set_lap_history(stopwatch, 2, DOP_LAP_DROP_NEWEST) == DOP_SUCCESS);
+    for (int i = 0; i < 4; i++) {
+        dop_stopwatch_lap(stopwatch);
+    }
+    dop_stopwatch_lap_stats(stopwatch, &stats);
+    assert(stats.count == 2 && stats.recorded == 4 && stats.dropped == 2);
+    dop_stopwatch_lap_view(stopwatch, &view);
+    assert(view.first_count == 2 && view.first[0].split_ns < view.first[1].split_ns);
+    
+    dop_stopwatch_reset(stopwatch);
+    dop_stopwatch_lap_stats(stopwatch, &stats);
+    assert(stats.count == 0 && stats.recorded == 0 && stats.max_ns == 0);
+    assert(dop_stopwatch_lap_percentile(stopwatch, 90.0) == 0);
+    
+    // Released with the component; a recycled slot starts without history
+    dop_func_destroy_component(stopwatch);
+    stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    dop_stopwatch_lap_stats(stopwatch, &stats);
+    assert(stats.count == 0 && stats.recorded == 0);
+    assert(dop_stopwatch_lap_stats(NULL, &stats) == DOP_ERROR_INVALID_PARAMETER);
+    dop_func_destroy_component(stopwatch);
+    printf("Stopwatch lap history test passed\n");
+}
+
+static void test_periodic_timer(void) {
+    printf("Testing periodic timers...\n");
+    
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    assert(timer);
+    dop_gate_open(timer);
+    assert(dop_timer_set_auto_restart(timer, true) == DOP_SUCCESS);
+    assert(dop_timer_set_duration(timer, 5) == DOP_SUCCESS);
+    assert(dop_timer_start(timer) == DOP_SUCCESS);
+    uint64_t origin_ns = timer->data.timer.start_ns;
+    uint64_t period_ns = timer->data.timer.duration_ns;
+    
+    // A late update skips the periods it slept through and stays on the grid
+    poll(NULL, 0, 30);
+    assert(dop_func_update_component(timer) == DOP_SUCCESS);
+    assert(timer->data.timer.is_running && !dop_timer_is_expired(timer));
+    assert(dop_timer_periods(timer) >= 5);
+    assert(dop_timer_missed_periods(timer) == dop_timer_periods(timer) - 1);
+    assert((timer->data.timer.start_ns - origin_ns) % period_ns == 0);
+    assert(dop_timer_remaining_ns(timer) <= period_ns);
+    assert(dop_timing_wheel_is_scheduled(timer));
+    assert(dop_checksum_verify(timer) == true);
+    
+    // Expiry on raw data: not due, then exactly on a boundary
+    dop_timer_data_t data = timer->data.timer;
+    assert(dop_timer_data_expire(&data, data.start_ns + 1) == false);
+    uint64_t periods = data.periods;
+    assert(dop_timer_data_expire(&data, data.start_ns + period_ns) == true);
+    assert(data.periods == periods + 1 && data.remaining_ns == period_ns);
+    
+    // Expiring a one-shot timer early leaves it running and on the wheel
+    dop_component_t* early = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_timer_set_duration(early, 10000);
+    dop_timer_start(early);
+    assert(dop_timer_expire(early) == DOP_SUCCESS);
+    assert(early->data.timer.is_running && !dop_timer_is_expired(early));
+    assert(dop_timing_wheel_is_scheduled(early) && dop_timer_periods(early) == 0);
+    dop_func_destroy_component(early);
+    
+    // Batch expiry: one-shot timers expire, periodic ones rearm, the rest are skipped
+    dop_component_t* timers[4];
+    for (int i = 0; i < 3; i++) {
+        timers[i] = dop_func_create_component(DOP_COMPONENT_TIMER);
+        dop_timer_set_duration(timers[i], 1);
+        dop_timer_set_auto_restart(timers[i], i == 0);
+        dop_timer_start(timers[i]);
+    }
+    timers[3] = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    poll(NULL, 0, 3);
+    dop_timer_stop(timers[2]);
+    assert(dop_timer_expire_batch(timers, 4, timers[0]->data.timer.start_ns + 2500000) == 2);
+    assert(timers[0]->data.timer.is_running && dop_timer_periods(timers[0]) == 2);
+    assert(dop_timer_missed_periods(timers[0]) == 1);
+    assert(dop_timing_wheel_is_scheduled(timers[0]));
+    assert(dop_timer_is_expired(timers[1]) && dop_timer_periods(timers[1]) == 1);
+    assert(!dop_timer_is_expired(timers[2]));
+    for (int i = 0; i < 4; i++) {
+        if (i < 3) assert(dop_checksum_verify(timers[i]) == true);
+        dop_func_destroy_component(timers[i]);
+    }
+    
+    // Restarting clears the counters; stopping leaves the wheel
+    dop_timer_start(timer);
+    assert(dop_timer_periods(timer) == 0 && dop_timer_missed_periods(timer) == 0);
+    dop_timer_stop(timer);
+    assert(!dop_timing_wheel_is_scheduled(timer));
+    assert(dop_timer_set_auto_restart(NULL, true) == DOP_ERROR_INVALID_PARAMETER);
+    dop_func_destroy_component(timer);
+    printf("Periodic timer test passed\n");
+}
+
+static void test_recurring_alarms(void) {
+    printf("Testing recurring alarms...\n");
+    
+    // Occurrences: strictly after the given time, on a repeat day
+    dop_time_t now = dop_time_now();
+    dop_alarm_data_t rule = { .alarm_time = now + 3600000, .repeat_days = DOP_ALARM_REPEAT_NONE };
+    dop_time_t occurrence = dop_alarm_next_occurrence(&rule, now);
+    assert(occurrence > now && occurrence <= now + 3600000);
+    assert(dop_time_second_of_day(occurrence) == dop_time_second_of_day(rule.alarm_time));
+    assert(dop_alarm_next_occurrence(&rule, occurrence) > occurrence + 86000000);
+    rule.repeat_days = (uint8_t)DOP_ALARM_DAY((dop_time_weekday(occurrence) + 3) % 7);
+    dop_time_t later = dop_alarm_next_occurrence(&rule, now);
+    assert(dop_time_weekday(later) == (dop_time_weekday(occurrence) + 3) % 7);
+    assert(later > occurrence + 2 * 86000000ull && later < occurrence + 4 * 87000000ull);
+    
+    // Range detection catches occurrences between sparse checks
+    rule.repeat_days = DOP_ALARM_REPEAT_NONE;
+    assert(dop_alarm_crossed(&rule, occurrence - 500, occurrence + 10));
+    assert(dop_alarm_crossed(&rule, occurrence - 3 * 3600000, occurrence + 2 * 3600000));
+    assert(!dop_alarm_crossed(&rule, occurrence, occurrence + 1000));
+    assert(!dop_alarm_crossed(&rule, occurrence - 2000, occurrence - 1000));
+    
+    // Occurrences keep the alarm's milliseconds
+    dop_alarm_data_t late = { .alarm_time = occurrence - occurrence % 1000 + 700 };
+    assert(dop_alarm_next_occurrence(&late, occurrence - occurrence % 1000 + 200) == late.alarm_time);
+    assert(dop_alarm_crossed(&late, late.alarm_time - 500, late.alarm_time));
+    assert(!dop_alarm_crossed(&late, late.alarm_time - 500, late.alarm_time - 1));
+    dop_component_t* precise = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_gate_open(precise);
+    dop_alarm_set_time(precise, dop_time_to_data(now + 1500));
+    dop_alarm_arm(precise);
+    assert(dop_alarm_index_time(precise) == now + 1500);
+    dop_func_destroy_component(precise);
+    
+    // Store kernel: an update that skipped the alarm second still fires it
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handle = dop_store_add(store, DOP_COMPONENT_ALARM);
+    dop_component_t* view = dop_store_view(store, handle);
+    dop_gate_open(view);
+    dop_alarm_set_time(view, dop_time_to_data(occurrence));
+    assert(dop_alarm_set_repeat(view, DOP_ALARM_REPEAT_DAILY) == DOP_SUCCESS);
+    assert(dop_alarm_set_repeat(view, 0x80) == DOP_ERROR_INVALID_PARAMETER);
+    dop_alarm_arm(view);
+    dop_store_shard_t* shard = dop_store_shard(store, handle);
+    uint32_t slot = DOP_HANDLE_SLOT(handle);
+    dop_handle_t changed[DOP_STORE_SHARD_CAPACITY];
+    // A slot without a view fires from its columns alone
+    dop_handle_t bare = dop_store_add(store, DOP_COMPONENT_ALARM);
+    uint32_t bare_slot = DOP_HANDLE_SLOT(bare);
+    assert(dop_store_shard(store, bare) == shard);
+    pthread_mutex_lock(&shard->mutex);
+    shard->gate[bare_slot] = DOP_GATE_OPEN;
+    shard->flags[bare_slot] |= DOP_SLOT_ARMED | ((uint32_t)DOP_ALARM_REPEAT_DAILY << DOP_SLOT_REPEAT_SHIFT);
+    shard->target_ms[bare_slot] = occurrence;
+    shard->time_ms[bare_slot] = occurrence - 5000;
+    shard->time_ms[slot] = occurrence - 5000;
+    assert(dop_store_update_shard(shard, occurrence - 1000, changed) == 0);
+    assert(dop_store_update_shard(shard, occurrence + 3000, changed) == 2 && changed[0] == handle);
+    assert(dop_alarm_index_time(view) == occurrence + 86400000);
+    // Recurring: fires again on the next day's occurrence
+    assert(dop_store_update_shard(shard, occurrence + 86400000 + 5000, changed) == 2);
+    pthread_mutex_unlock(&shard->mutex);
+    dop_store_destroy(store);
+    
+    // Firing index: the earliest occurrence is at the root
+    size_t base = dop_alarm_index_count();
+    dop_component_t* alarms[3];
+    const uint64_t offsets_ms[3] = { 3 * 3600000, 1 * 3600000, 2 * 3600000 };
+    for (int i = 0; i < 3; i++) {
+        alarms[i] = dop_func_create_component(DOP_COMPONENT_ALARM);
+        dop_gate_open(alarms[i]);
+        dop_alarm_set_time(alarms[i], dop_time_to_data(now + offsets_ms[i]));
+        dop_alarm_arm(alarms[i]);
+    }
+    dop_alarm_set_repeat(alarms[2], DOP_ALARM_REPEAT_DAILY);
+    assert(dop_alarm_index_count() == base + 3);
+    dop_time_t fire_time;
+    assert(dop_alarm_index_next(&fire_time) == alarms[1]);
+    assert(fire_time == dop_alarm_index_time(alarms[1]) && fire_time <= now + offsets_ms[1]);
+    
+    // One-shot alarms leave the index; recurring ones move a day on
+    assert(dop_alarm_index_fire_due(now + 90 * 60000, NULL, NULL) == 1);
+    assert(dop_alarm_is_triggered(alarms[1]) && dop_alarm_index_time(alarms[1]) == DOP_ALARM_INDEX_NONE);
+    assert(dop_alarm_index_next(NULL) == alarms[2]);
+    dop_time_t pending = dop_alarm_index_time(alarms[2]);
+    assert(dop_alarm_index_fire_due(now + 150 * 60000, NULL, NULL) == 1);
+    assert(dop_alarm_is_triggered(alarms[2]) && dop_alarm_index_time(alarms[2]) == pending + 86400000);
+    assert(dop_timing_wheel_is_scheduled(alarms[2]));
+    assert(dop_alarm_index_next(NULL) == alarms[0]);
+    assert(dop_checksum_verify(alarms[2]) == true);
+    
+    dop_alarm_disarm(alarms[0]);
+    assert(dop_alarm_index_time(alarms[0]) == DOP_ALARM_INDEX_NONE);
+    for (int i = 0; i < 3; i++) {
+        dop_func_destroy_component(alarms[i]);
+    }
+    assert(dop_alarm_index_count() == base);
+    printf("Recurring alarm test passed\n");
+}
+
+static void test_timezone_tables(void) {
+    printf("Testing timezone tables...\n");
+    
+    // Fixed offsets are signed seconds and drive formatting
+    dop_component_t* clock = dop_func_create_component(DOP_COMPONENT_CLOCK);
+    dop_gate_open(clock);
+    assert(dop_clock_set_timezone(clock, -5) == DOP_SUCCESS);
+    assert(dop_clock_set_timezone(clock, 15) == DOP_ERROR_INVALID_PARAMETER);
+    dop_func_update_component(clock);
+    assert(clock->data.clock.timezone_offset == -18000 && clock->data.clock.timezone_id == DOP_TZ_FIXED);
+    char formatted[DOP_CLOCK_FORMAT_SIZE];
+    assert(dop_clock_format_time_into(clock, formatted, sizeof(formatted)) == 12);
+    int64_t local_second = (int64_t)(clock->data.clock.current_time / 1000) - 18000;
+    assert((formatted[0] - '0') * 10 + (formatted[1] - '0') == (int)((local_second % 86400 + 86400) % 86400 / 3600));
+    assert(dop_checksum_verify(clock) == true);
+    
+    assert(dop_clock_set_zone(clock, "../etc/passwd") == DOP_ERROR_INVALID_PARAMETER);
+    assert(dop_clock_set_zone(clock, "No/Such_Zone") == DOP_ERROR_INVALID_STATE);
+    uint16_t new_york;
+    if (dop_tz_load("America/New_York", &new_york) != DOP_SUCCESS) {
+        // No tzdata on this host; fixed offsets are all that can be checked
+        dop_func_destroy_component(clock);
+        printf("Timezone table test passed (no tzdata)\n");
+        return;
+    }
+    
+    // Recorded history, the exact DST boundary, and the expanded footer rule
+    uint16_t again, sydney, kolkata;
+    assert(dop_tz_load("America/New_York", &again) == DOP_SUCCESS && again == new_york);
+    assert(strcmp(dop_tz_name(new_york), "America/New_York") == 0);
+    assert(dop_tz_offset(new_york, 1705320000000ull) == -18000);
+    assert(dop_tz_offset(new_york, 1721044800000ull) == -14400);
+    assert(dop_tz_offset(new_york, 1710053999000ull) == -18000);
+    assert(dop_tz_offset(new_york, 1710054000000ull) == -14400);
+    assert(dop_tz_offset(new_york, 3471336000000ull) == -18000);
+    assert(dop_tz_offset(new_york, 3487060800000ull) == -14400);
+    assert(dop_tz_load("Australia/Sydney", &sydney) == DOP_SUCCESS);
+    assert(dop_tz_offset(sydney, 1705320000000ull) == 39600 && dop_tz_offset(sydney, 3487060800000ull) == 36000);
+    assert(dop_tz_load("Asia/Kolkata", &kolkata) == DOP_SUCCESS);
+    
+    // One instant in many zones
+    const uint16_t zones[4] = { new_york, new_york, sydney, kolkata };
+    int32_t offsets[4];
+    dop_tz_offset_batch(zones, 4, 1721044800000ull, offsets);
+    assert(offsets[0] == -14400 && offsets[1] == -14400 && offsets[2] == 36000 && offsets[3] == 19800);
+    
+    // Named zones follow updates; the name survives the wire
+    assert(dop_clock_set_zone(clock, "Asia/Kolkata") == DOP_SUCCESS);
+    dop_func_update_component(clock);
+    assert(clock->data.clock.timezone_offset == 19800 && clock->data.clock.timezone_id == kolkata);
+    assert(dop_checksum_verify(clock) == true);
+    dop_wire_record_t record;
+    assert(dop_wire_encode(clock, &record) == DOP_SUCCESS);
+    assert(record.data.clock.timezone_kind == DOP_WIRE_TZ_NAMED);
+    dop_component_data_t data;
+    assert(dop_wire_decode_data(&record, &data) == DOP_SUCCESS && data.clock.timezone_id == kolkata);
+    assert(dop_clock_set_zone(clock, NULL) == DOP_SUCCESS && clock->data.clock.timezone_id == DOP_TZ_LOCAL);
+    dop_func_destroy_component(clock);
+    
+    // Store columns resolve zones in the batched update
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handle = dop_store_add(store, DOP_COMPONENT_CLOCK);
+    dop_component_t* view = dop_store_view(store, handle);
+    dop_gate_open(view);
+    dop_clock_set_zone(view, "Australia/Sydney");
+    dop_store_shard_t* shard = dop_store_shard(store, handle);
+    dop_handle_t changed[DOP_STORE_SHARD_CAPACITY];
+    pthread_mutex_lock(&shard->mutex);
+    dop_store_update_shard(shard, 1705320000000ull, changed);
+    assert(shard->param[DOP_HANDLE_SLOT(handle)] == 39600);
+    dop_store_update_shard(shard, 1721044800000ull, changed);
+    assert(shard->param[DOP_HANDLE_SLOT(handle)] == 36000);
+    pthread_mutex_unlock(&shard->mutex);
+    assert(dop_store_view(store, handle)->data.clock.timezone_id == sydney);
+    dop_store_destroy(store);
+    printf("Timezone table test passed\n");
+}
+
+typedef struct {
+    dop_journal_event_t events[32];
+    size_t count;
+    size_t batches;
+} journal_capture_t;
+
+static void capture_journal(const dop_journal_event_t* events, size_t count, void* context) {
+    journal_capture_t* capture = context;
+    for (size_t i = 0; i < count && capture->count < 32; i++) {
+        capture->events[capture->count++] = events[i];
+    }
+    capture->batches++;
+}
+
+static size_t count_journal_kind(const journal_capture_t* capture, dop_journal_kind_t kind) {
+    size_t count = 0;
+    for (size_t i = 0; i < capture->count; i++) {
+        if (capture->events[i].kind == kind) count++;
+    }
+    return count;
+}
+
+typedef struct {
+    uint64_t next_sequence[8];
+    size_t count;
+    bool ordered;
+} journal_order_t;
+
+static void check_journal_order(const dop_journal_event_t* events, size_t count, void* context) {
+    journal_order_t* order = context;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t producer = events[i].producer;
+        if (producer >= 8 || events[i].sequence < order->next_sequence[producer]) order->ordered = false;
+        if (producer < 8) order->next_sequence[producer] = events[i].sequence + 1;
+    }
+    order->count += count;
+}
+
+static void* flip_gates(void* context) {
+    dop_component_t* clock = context;
+    for (int i = 0; i < 5000; i++) {
+        dop_gate_open(clock);
+        dop_gate_close(clock);
+    }
+    return NULL;
+}
+
+static void test_change_journal(void) {
+    printf("Testing change journal...\n");
+    
+    journal_capture_t capture = {0};
+    assert(dop_journal_drain(capture_journal, &capture, SIZE_MAX) == 0);
+    assert(dop_journal_set_enabled(true) == DOP_ERROR_INVALID_STATE);
+    assert(dop_journal_init(0, 8) == DOP_ERROR_INVALID_PARAMETER);
+    assert(dop_journal_init(16, DOP_JOURNAL_MAX_RINGS + 1) == DOP_ERROR_INVALID_PARAMETER);
+    
+    dop_component_t* stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    dop_component_t* alarm = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    assert(stopwatch && alarm && timer);
+    dop_stopwatch_start(stopwatch);
+    
+    assert(dop_journal_init(16, 8) == DOP_SUCCESS && dop_journal_enabled());
+    assert(dop_journal_init(16, 8) == DOP_ERROR_INVALID_STATE);
+    
+    // Only actual transitions are recorded
+    dop_stopwatch_pause(stopwatch);
+    dop_stopwatch_pause(stopwatch);
+    dop_stopwatch_start(stopwatch);
+    dop_stopwatch_stop(stopwatch);
+    dop_alarm_arm(alarm);
+    dop_alarm_arm(alarm);
+    dop_alarm_fire(alarm, dop_alarm_index_time(alarm));
+    dop_alarm_snooze(alarm, 5000);
+    dop_alarm_disarm(alarm);
+    dop_gate_open(timer);
+    dop_gate_open(timer);
+    dop_timer_set_duration(timer, 1);
+    dop_timer_start(timer);
+    assert(dop_timer_expire_batch(&timer, 1, timer->data.timer.start_ns + 1000000) == 1);
+    
+    static const dop_journal_kind_t expected[] = {
+        DOP_JOURNAL_PAUSE, DOP_JOURNAL_RESUME, DOP_JOURNAL_STOP,
+        DOP_JOURNAL_ARM, DOP_JOURNAL_TRIGGER, DOP_JOURNAL_SNOOZE, DOP_JOURNAL_DISARM,
+        DOP_JOURNAL_GATE, DOP_JOURNAL_START, DOP_JOURNAL_EXPIRE
+    };
+    const dop_component_t* sources[] = { stopwatch, stopwatch, stopwatch, alarm, alarm, alarm, alarm,
+                                         timer, timer, timer };
+    assert(dop_journal_drain(capture_journal, &capture, SIZE_MAX) == 10);
+    assert(capture.count == 10 && capture.batches == 1);
+    for (size_t i = 0; i < 10; i++) {
+        const dop_journal_event_t* event = &capture.events[i];
+        assert(event->kind == expected[i]);
+        assert(event->type == sources[i]->metadata.type);
+        assert(event->cold_index == sources[i]->metadata.cold_index);
+        assert(event->handle == DOP_HANDLE_INVALID);
+        assert(event->sequence == i && event->producer == capture.events[0].producer);
+        assert(i == 0 || event->timestamp_ns >= capture.events[i - 1].timestamp_ns);
+    }
+    assert(capture.events[5].value == 5000);
+    assert(capture.events[7].value == DOP_GATE_OPEN);
+    assert(capture.events[9].value == 1);
+    assert(dop_journal_drain(capture_journal, &capture, SIZE_MAX) == 0);
+    
+    // Paused recording counts nothing
+    assert(dop_journal_set_enabled(false) == DOP_SUCCESS);
+    dop_gate_close(timer);
+    assert(dop_journal_set_enabled(true) == DOP_SUCCESS);
+    
+    // A full ring drops new events and leaves a gap in the sequence
+    dop_journal_stats_t stats;
+    assert(dop_journal_stats(&stats) == DOP_SUCCESS);
+    uint64_t dropped = stats.dropped;
+    for (int i = 0; i < 10; i++) {
+        dop_gate_open(timer);
+        dop_gate_close(timer);
+    }
+    assert(dop_journal_stats(&stats) == DOP_SUCCESS);
+    assert(stats.pending == 16 && stats.dropped == dropped + 4);
+    capture.count = 0;
+    capture.batches = 0;
+    assert(dop_journal_drain(capture_journal, &capture, 4) == 4);
+    assert(dop_journal_drain(capture_journal, &capture, SIZE_MAX) == 12);
+    assert(capture.batches == 3);                    // The second drain wraps the ring
+    assert(capture.events[0].sequence == 10 && capture.events[15].sequence == 25);
+    dop_gate_open(timer);
+    capture.count = 0;
+    assert(dop_journal_drain(capture_journal, &capture, SIZE_MAX) == 1);
+    assert(capture.events[0].sequence == 30);
+    
+    // Store kernels journal slot transitions by handle
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t handle = dop_store_add(store, DOP_COMPONENT_TIMER);
+    dop_component_t* view = dop_store_view(store, handle);
+    dop_gate_open(view);
+    dop_timer_set_duration(view, 1);
+    dop_timer_start(view);
+    while (dop_timer_remaining_ns(dop_store_view(store, handle)) > 0) {
+    }
+    assert(dop_func_update_components(store, &handle, 1, dop_time_get_current().timestamp_ms, NULL, NULL) == DOP_SUCCESS);
+    capture.count = 0;
+    assert(dop_journal_drain(capture_journal, &capture, SIZE_MAX) == 3);
+    assert(capture.events[0].kind == DOP_JOURNAL_GATE && capture.events[0].handle == handle);
+    assert(capture.events[1].kind == DOP_JOURNAL_START && capture.events[1].handle == handle);
+    assert(capture.events[2].kind == DOP_JOURNAL_EXPIRE && capture.events[2].handle == handle);
+    assert(capture.events[2].cold_index == DOP_COLD_INVALID && capture.events[2].type == DOP_COMPONENT_TIMER);
+    dop_store_destroy(store);
+    
+    // An occurrence caught by an update is not fired again by the wheel
+    dop_component_t* due = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_gate_open(due);
+    dop_alarm_set_time(due, dop_time_to_data(dop_time_now()));
+    dop_alarm_arm(due);
+    due->data.alarm.current_time = dop_alarm_index_time(due) - 1;
+    due->checksum = dop_checksum_calculate(due);
+    assert(dop_func_update_component(due) == DOP_SUCCESS && dop_alarm_is_triggered(due));
+    assert(dop_alarm_index_time(due) == DOP_ALARM_INDEX_NONE && !dop_timing_wheel_is_scheduled(due));
+    dop_timing_wheel_advance(dop_timing_wheel_default(), dop_time_monotonic_ms() + 10, NULL, NULL);
+    assert(dop_alarm_fire(due, dop_time_now()) == DOP_SUCCESS);
+    capture.count = 0;
+    dop_journal_drain(capture_journal, &capture, SIZE_MAX);
+    assert(count_journal_kind(&capture, DOP_JOURNAL_TRIGGER) == 1 && dop_checksum_verify(due));
+    dop_func_destroy_component(due);
+    
+    // So is a recurring occurrence reached by a deadline pass
+    dop_deadline_scheduler_t* scheduler = dop_deadline_scheduler_create();
+    dop_component_t* daily = dop_func_create_component(DOP_COMPONENT_ALARM);
+    dop_gate_open(daily);
+    dop_alarm_set_time(daily, dop_time_to_data(dop_time_now()));
+    dop_alarm_set_repeat(daily, DOP_ALARM_REPEAT_DAILY);
+    dop_alarm_arm(daily);
+    dop_time_t occurrence = dop_alarm_index_time(daily);
+    daily->data.alarm.current_time = occurrence - 1;
+    daily->checksum = dop_checksum_calculate(daily);
+    assert(dop_deadline_add(scheduler, daily) == DOP_SUCCESS);
+    assert(dop_deadline_run_due(scheduler, dop_time_monotonic_ns()) == 1);
+    assert(dop_alarm_index_time(daily) > occurrence);
+    capture.count = 0;
+    dop_journal_drain(capture_journal, &capture, SIZE_MAX);
+    assert(count_journal_kind(&capture, DOP_JOURNAL_TRIGGER) == 1);
+    assert(dop_deadline_remove(scheduler, daily) == DOP_SUCCESS);
+    dop_func_destroy_component(daily);
+    dop_deadline_scheduler_destroy(scheduler);
+    
+    // And one a store pass fires through a slot's view; a snooze comes due there too
+    store = dop_store_create();
+    handle = dop_store_add(store, DOP_COMPONENT_ALARM);
+    view = dop_store_view(store, handle);
+    dop_gate_open(view);
+    dop_alarm_set_time(view, dop_time_to_data(dop_time_now()));
+    dop_alarm_arm(view);
+    dop_handle_t fired = DOP_HANDLE_INVALID;
+    size_t fired_count = 0;
+    assert(dop_func_update_components(store, &handle, 1, dop_time_now(), &fired, &fired_count) == DOP_SUCCESS);
+    assert(fired_count == 1 && fired == handle && dop_alarm_is_triggered(dop_store_view(store, handle)));
+    assert(dop_alarm_index_time(view) == DOP_ALARM_INDEX_NONE && !dop_timing_wheel_is_scheduled(view));
+    dop_timing_wheel_advance(dop_timing_wheel_default(), dop_time_monotonic_ms() + 10, NULL, NULL);
+    dop_alarm_snooze(view, 0);
+    assert(dop_func_update_components(store, &handle, 1, dop_time_now(), &fired, &fired_count) == DOP_SUCCESS);
+    assert(fired_count == 1 && !dop_timing_wheel_is_scheduled(view));
+    capture.count = 0;
+    dop_journal_drain(capture_journal, &capture, SIZE_MAX);
+    assert(count_journal_kind(&capture, DOP_JOURNAL_TRIGGER) == 2);
+    dop_store_destroy(store);
+    
+    // A store pass that expires a timer takes its view off the wheel, or
+    // moves a periodic one to its next deadline
+    store = dop_store_create();
+    dop_handle_t expiring[2];
+    dop_component_t* views[2];
+    for (int i = 0; i < 2; i++) {
+        expiring[i] = dop_store_add(store, DOP_COMPONENT_TIMER);
+        views[i] = dop_store_view(store, expiring[i]);
+        dop_gate_open(views[i]);
+        dop_timer_set_auto_restart(views[i], i == 1);
+        dop_timer_set_duration(views[i], 1);
+        dop_timer_start(views[i]);
+    }
+    while (dop_timer_remaining_ns(dop_store_view(store, expiring[0])) > 0 ||
+           dop_timer_remaining_ns(views[1]) > 0) {
+    }
+    assert(dop_func_update_components(store, expiring, 2, dop_time_now(), NULL, NULL) == DOP_SUCCESS);
+    assert(!dop_timing_wheel_is_scheduled(views[0]));
+    const dop_timer_data_t* periodic = &dop_store_view(store, expiring[1])->data.timer;
+    uint64_t periods_ended = periodic->periods;
+    assert(periods_ended >= 1 && dop_timing_wheel_deadline(dop_timing_wheel_default(), views[1]) ==
+           (periodic->start_ns + periodic->duration_ns + DOP_NS_PER_MS - 1) / DOP_NS_PER_MS);
+    dop_timing_wheel_advance(dop_timing_wheel_default(), dop_time_monotonic_ms(), NULL, NULL);
+    assert(dop_timer_periods(dop_store_view(store, expiring[1])) >= periods_ended);
+    capture.count = 0;
+    dop_journal_drain(capture_journal, &capture, SIZE_MAX);
+    size_t one_shot_expiries = 0;
+    for (size_t i = 0; i < capture.count; i++) {
+        if (capture.events[i].kind == DOP_JOURNAL_EXPIRE && capture.events[i].handle == expiring[0]) one_shot_expiries++;
+    }
+    assert(one_shot_expiries == 1 && dop_timer_periods(dop_store_view(store, expiring[0])) == 1);
+    dop_store_destroy(store);
+    
+    // Concurrent producers each get a ring and keep their order
+    enum { THREADS = 4 };
+    pthread_t threads[THREADS];
+    dop_component_t* clocks[THREADS];
+    assert(dop_func_create_components(DOP_COMPONENT_CLOCK, clocks, THREADS) == THREADS);
+    assert(dop_journal_stats(&stats) == DOP_SUCCESS);
+    uint64_t recorded = stats.recorded;
+    dropped = stats.dropped;
+    for (int i = 0; i < THREADS; i++) {
+        assert(pthread_create(&threads[i], NULL, flip_gates, clocks[i]) == 0);
+    }
+    journal_order_t order = { .ordered = true };
+    for (int i = 0; i < 200; i++) {
+        dop_journal_drain(check_journal_order, &order, SIZE_MAX);
+    }
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    dop_journal_drain(check_journal_order, &order, SIZE_MAX);
+    assert(order.ordered);
+    assert(dop_journal_stats(&stats) == DOP_SUCCESS);
+    assert(stats.pending == 0 && stats.recorded - recorded == order.count);
+    assert(order.count + (stats.dropped - dropped) == THREADS * 10000);
+    assert(stats.rings_owned == 1);                  // Exited threads handed theirs back
+    
+    dop_func_destroy_components(clocks, THREADS);
+    dop_func_destroy_component(stopwatch);
+    dop_func_destroy_component(alarm);
+    dop_func_destroy_component(timer);
+    printf("Change journal test passed\n");
+}
+
+static void test_store_snapshot(void) {
+    printf("Testing store snapshots...\n");
+    
+    char path[] = "/tmp/dop_snapshot_XXXXXX";
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+    
+    // Enough timers to span two shards, plus one of every other type
+    enum { TIMERS = DOP_STORE_SHARD_CAPACITY + 10 };
+    dop_component_store_t* store = dop_store_create();
+    dop_handle_t* timers = malloc(TIMERS * sizeof(dop_handle_t));
+    for (int i = 0; i < TIMERS; i++) {
+        timers[i] = dop_store_add(store, DOP_COMPONENT_TIMER);
+    }
+    dop_store_remove(store, timers[3]);
+    dop_handle_t clock = dop_store_add(store, DOP_COMPONENT_CLOCK);
+    dop_handle_t stopwatch = dop_store_add(store, DOP_COMPONENT_STOPWATCH);
+    dop_handle_t alarm = dop_store_add(store, DOP_COMPONENT_ALARM);
+    
+    dop_component_t* view = dop_store_view(store, timers[0]);
+    dop_gate_open(view);
+    dop_timer_set_duration(view, 60000);
+    dop_timer_start(view);
+    uint64_t remaining_ns = dop_timer_remaining_ns(view);
+    dop_stopwatch_start(dop_store_view(store, stopwatch));
+    dop_alarm_arm(dop_store_view(store, alarm));
+    dop_gate_open(dop_store_view(store, alarm));
+    bool have_zone = dop_clock_set_zone(dop_store_view(store, clock), "Asia/Kolkata") == DOP_SUCCESS;
+    
+    assert(dop_snapshot_write(store, path) == DOP_SUCCESS);
+    assert(dop_snapshot_write(NULL, path) == DOP_ERROR_INVALID_PARAMETER);
+    
+    // The restored store is usable at once and keeps handles and free slots
+    dop_component_store_t* restored = NULL;
+    assert(dop_snapshot_restore(path, &restored) == DOP_SUCCESS && restored);
+    assert(dop_store_count(restored, DOP_COMPONENT_TIMER) == TIMERS - 1);
+    assert(!dop_store_contains(restored, timers[3]));
+    assert(dop_store_add(restored, DOP_COMPONENT_TIMER) == timers[3]);
+    view = dop_store_view(restored, timers[0]);
+    assert(view && dop_checksum_verify(view));
+    assert(dop_gate_is_accessible(view) && view->data.timer.is_running);
+    assert(dop_timer_remaining_ns(view) <= remaining_ns);
+    assert(dop_timer_remaining_ns(view) > remaining_ns - 1000000000ull);
+    assert(dop_store_view(restored, stopwatch)->data.stopwatch.is_running);
+    assert(dop_store_view(restored, alarm)->data.alarm.is_armed);
+    if (have_zone) {
+        dop_component_t* restored_clock = dop_store_view(restored, clock);
+        assert(strcmp(dop_tz_name(restored_clock->data.clock.timezone_id), "Asia/Kolkata") == 0);
+        assert(restored_clock->data.clock.timezone_offset == 19800);
+    }
+    
+    // Writes go to the private mapping, not the file
+    dop_timer_stop(view);
+    size_t failed = 1;
+    assert(dop_snapshot_verify(restored, 0, &failed) == DOP_SUCCESS && failed == 0);
+    dop_store_destroy(restored);
+    
+    // A corrupted slot is isolated, whether found lazily or by verification
+    dop_snapshot_header_t header;
+    fd = open(path, O_RDWR);
+    assert(fd >= 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header));
+    uint64_t row = 0;
+    for (int type = 0; type < DOP_COMPONENT_TIMER; type++) {
+        row += header.shard_count[type];
+    }
+    uint64_t slot_offset = header.shards_offset + row * header.shard_stride +
+                           offsetof(dop_store_shard_t, span_ns) + 5 * sizeof(uint64_t);
+    uint64_t corrupt = 12345;
+    assert(pwrite(fd, &corrupt, sizeof(corrupt), (off_t)slot_offset) == sizeof(corrupt));
+    close(fd);
+    assert(dop_snapshot_restore(path, &restored) == DOP_SUCCESS);
+    view = dop_store_view(restored, timers[0]);
+    assert(view->data.timer.is_running && dop_checksum_verify(view));
+    dop_component_t* damaged = dop_store_view(restored, timers[5]);
+    assert(!dop_gate_is_accessible(damaged) && damaged->metadata.state == DOP_STATE_ERROR);
+    assert(dop_snapshot_verify(restored, 4, &failed) == DOP_ERROR_CHECKSUM_FAILED && failed == 1);
+    dop_store_destroy(restored);
+    
+    // Foreign and truncated files are refused
+    fd = open(path, O_RDWR);
+    assert(fd >= 0 && ftruncate(fd, (off_t)header.shards_offset) == 0);
+    close(fd);
+    assert(dop_snapshot_restore(path, &restored) == DOP_ERROR_INVALID_STATE && !restored);
+    unlink(path);
+    assert(dop_snapshot_restore(path, &restored) == DOP_ERROR_INVALID_STATE);
+    assert(dop_snapshot_verify(store, 0, &failed) == DOP_SUCCESS && failed == 0);
+    
+    free(timers);
+    dop_store_destroy(store);
+    printf("Store snapshot test passed\n");
+}
+
+static void test_packed_time(void) {
+    printf("Testing packed time...\n");
+    
+    dop_time_t now = dop_time_now();
+    dop_time_data_t expanded = dop_time_to_data(now);
+    assert(expanded.timestamp_ms == now && expanded.is_valid);
+    assert(expanded.hours == dop_time_hours(now) && expanded.minutes == dop_time_minutes(now));
+    assert(expanded.seconds == dop_time_seconds(now) && expanded.milliseconds == dop_time_milliseconds(now));
+    assert(dop_time_from_data(expanded) == now);
+    
+    // Edited calendar fields move the timestamp within its local day
+    expanded.hours = 7;
+    expanded.minutes = 30;
+    dop_time_t edited = dop_time_from_data(expanded);
+    assert(dop_time_hours(edited) == 7 && dop_time_minutes(edited) == 30);
+    assert(dop_time_seconds(edited) == expanded.seconds);
+    
+    dop_time_t times[4] = { now, now + 1, now + 900000, now + 86400000 };
+    dop_time_data_t batch[4];
+    dop_time_decompose_batch(times, 4, batch);
+    for (int i = 0; i < 4; i++) {
+        dop_time_data_t single = dop_time_to_data(times[i]);
+        assert(batch[i].timestamp_ms == single.timestamp_ms && batch[i].hours == single.hours);
+        assert(batch[i].minutes == single.minutes && batch[i].seconds == single.seconds);
+    }
+    
+    // A transition inside a window: every second resolves on the right side
+    const char* zone = getenv("TZ");
+    char saved_zone[128] = "";
+    if (zone) snprintf(saved_zone, sizeof(saved_zone), "%s", zone);
+    setenv("TZ", "EST5EDT,M3.2.0/2:07,M11.1.0", 1);
+    dop_time_tz_changed();
+    dop_time_t spring[64];
+    dop_time_data_t expanded_spring[64];
+    for (int i = 0; i < 64; i++) {
+        spring[i] = (1710054420ull - 32 + (uint64_t)i) * 1000;    // 2024-03-10 07:07:00 UTC +- 32s
+    }
+    dop_time_decompose_batch(spring, 64, expanded_spring);
+    for (int i = 0; i < 64; i++) {
+        time_t seconds = (time_t)(spring[i] / 1000);
+        struct tm local;
+        localtime_r(&seconds, &local);
+        assert(expanded_spring[i].hours == (uint32_t)local.tm_hour);
+        assert(expanded_spring[i].minutes == (uint32_t)local.tm_min);
+        assert(dop_time_hours(spring[i]) == (uint32_t)local.tm_hour);
+    }
+    assert(expanded_spring[31].hours == 2 && expanded_spring[32].hours == 3);
+    if (zone) setenv("TZ", saved_zone, 1); else unsetenv("TZ");
+    dop_time_tz_changed();
+    
+    assert(sizeof(dop_time_t) == 8);
+    printf("Packed time test passed\n");
+}
+
+static void* read_current_time(void* context) {
+    size_t* mismatches = context;
+    for (int i = 0; i < 20000; i++) {
+        dop_time_data_t now = dop_time_get_current();
+        time_t seconds = (time_t)(now.timestamp_ms / 1000);
+        struct tm local;
+        localtime_r(&seconds, &local);
+        if (!now.is_valid || now.hours != (uint32_t)local.tm_hour ||
+            now.minutes != (uint32_t)local.tm_min || now.seconds != (uint32_t)local.tm_sec ||
+            now.milliseconds != now.timestamp_ms % 1000) {
+            (*mismatches)++;
+        }
+    }
+    return NULL;
+}
+
+static void test_time_source(void) {
+    printf("Testing time source...\n");
+    
+    // Worker threads each keep their own cache and agree with localtime_r
+    pthread_t threads[4];
+    size_t mismatches[4] = {0};
+    for (int i = 0; i < 4; i++) {
+        assert(pthread_create(&threads[i], NULL, read_current_time, &mismatches[i]) == 0);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+        assert(mismatches[i] == 0);
+    }
+    
+    // A timezone change is picked up by the next call, not the next second
+    const char* zone = getenv("TZ");
+    char saved_zone[128] = "";
+    if (zone) snprintf(saved_zone, sizeof(saved_zone), "%s", zone);
+    setenv("TZ", "UTC0", 1);
+    dop_time_tz_changed();
+    dop_time_data_t utc = dop_time_get_current();
+    setenv("TZ", "<+0530>-5:30", 1);
+    dop_time_tz_changed();
+    dop_time_data_t india = dop_time_get_current();
+    assert(dop_time_utc_offset(india.timestamp_ms) == 19800);
+    uint32_t utc_minute = utc.hours * 60 + utc.minutes;
+    uint32_t india_minute = india.hours * 60 + india.minutes;
+    assert(india.timestamp_ms - utc.timestamp_ms < 60000);
+    assert((utc_minute + 330) % 1440 == india_minute || (utc_minute + 331) % 1440 == india_minute);
+    if (zone) setenv("TZ", saved_zone, 1); else unsetenv("TZ");
+    dop_time_tz_changed();
+    
+    printf("Time source test passed\n");
+}
+
+static void test_monotonic_durations(void) {
+    printf("Testing monotonic durations...\n");
+    
+    dop_component_t* stopwatch = dop_func_create_component(DOP_COMPONENT_STOPWATCH);
+    assert(dop_stopwatch_elapsed_ns(stopwatch) == 0);
+    dop_stopwatch_start(stopwatch);
+    uint64_t running = dop_stopwatch_elapsed_ns(stopwatch);
+    while (dop_stopwatch_elapsed_ns(stopwatch) == running) {
+    }
+    
+    // Paused time is excluded and the value stays frozen until resumed
+    dop_stopwatch_pause(stopwatch);
+    uint64_t paused = dop_stopwatch_elapsed_ns(stopwatch);
+    assert(paused > running);
+    assert(dop_stopwatch_elapsed_ns(stopwatch) == paused);
+    dop_stopwatch_start(stopwatch);
+    assert(dop_stopwatch_elapsed_ns(stopwatch) >= paused);
+    dop_stopwatch_stop(stopwatch);
+    assert(dop_checksum_verify(stopwatch));
+    
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_timer_set_duration_ns(timer, 5000000000ull);
+    assert(dop_timer_remaining_ns(timer) == 5000000000ull);
+    dop_timer_start(timer);
+    dop_timer_stop(timer);
+    uint64_t remaining = dop_timer_remaining_ns(timer);
+    assert(remaining > 0 && remaining < 5000000000ull);
+    assert(dop_timer_remaining_ns(timer) == remaining);
+    assert(dop_checksum_verify(timer));
+    
+    dop_func_destroy_component(stopwatch);
+    dop_func_destroy_component(timer);
+    printf("Monotonic durations test passed\n");
+}
+
+static void count_fired(dop_component_t* component, void* context) {
+    (void)component;
+    (*(int*)context)++;
+}
+
+typedef struct {
+    dop_component_t* pair[2];
+    dop_component_t* survivor;
+    int seen;
+} wheel_pair_t;
+
+static void destroy_partner(dop_component_t* component, void* context) {
+    wheel_pair_t* pair = context;
+    for (int i = 0; i < 2; i++) {
+        if (component == pair->pair[i]) {
+            pair->seen++;
+            pair->survivor = component;
+            dop_func_destroy_component(pair->pair[1 - i]);
+        }
+    }
+}
+
+static void test_timing_wheel(void) {
+    printf("Testing timing wheel...\n");
+    
+    // Private wheel on a synthetic clock starting mid-second
+    dop_timing_wheel_t* wheel = dop_timing_wheel_create(3599500);
+    assert(wheel != NULL);
+    assert(dop_timing_wheel_next_deadline(wheel) == UINT64_MAX);
+    
+    uint64_t deadlines[] = { 3599900, 3600200, 3659000, 3700000, 3600000 + 86400000ull * 2,
+                             3600000 + 86400000ull * 3 };
+    dop_component_t* timers[6];
+    for (int i = 0; i < 6; i++) {
+        timers[i] = dop_func_create_component(DOP_COMPONENT_TIMER);
+        timers[i]->data.timer.is_running = true;
+        timers[i]->checksum = dop_checksum_calculate(timers[i]);
+        assert(dop_timing_wheel_schedule(wheel, timers[i], deadlines[i]) == DOP_SUCCESS);
+        assert(dop_timing_wheel_is_scheduled(timers[i]));
+    }
+    assert(dop_timing_wheel_next_deadline(wheel) == 3599900);
+    
+    int fired = 0;
+    assert(dop_timing_wheel_advance(wheel, 3599899, count_fired, &fired) == 0);
+    assert(dop_timing_wheel_advance(wheel, 3599900, count_fired, &fired) == 1);
+    assert(dop_timer_is_expired(timers[0]) && !timers[0]->data.timer.is_running);
+    assert(dop_checksum_verify(timers[0]));
+    
+    // Crossing the hour boundary cascades the next two down
+    assert(dop_timing_wheel_cancel(wheel, timers[3]) == DOP_SUCCESS);
+    assert(!dop_timing_wheel_is_scheduled(timers[3]));
+    assert(dop_timing_wheel_advance(wheel, 3700000, count_fired, &fired) == 2);
+    assert(dop_timer_is_expired(timers[1]) && dop_timer_is_expired(timers[2]));
+    assert(!dop_timer_is_expired(timers[3]));
+    
+    // Overflow entries survive until their day arrives, several at once
+    assert(dop_timing_wheel_next_deadline(wheel) == deadlines[4]);
+    assert(dop_timing_wheel_advance(wheel, deadlines[4] - 1, count_fired, &fired) == 0);
+    assert(dop_timing_wheel_advance(wheel, deadlines[4], count_fired, &fired) == 1);
+    assert(fired == 4);
+    
+    // Past deadlines fire on the next advance
+    dop_timing_wheel_schedule(wheel, timers[3], 1000);
+    assert(dop_timing_wheel_advance(wheel, deadlines[4], NULL, NULL) == 1);
+    assert(dop_timing_wheel_next_deadline(wheel) == deadlines[5]);
+    assert(dop_timing_wheel_cancel(wheel, timers[5]) == DOP_SUCCESS);
+    
+    for (int i = 0; i < 6; i++) {
+        dop_func_destroy_component(timers[i]);
+    }
+    dop_timing_wheel_destroy(wheel);
+    
+    // Fired components stay pinned; a callback may destroy the rest of its batch
+    wheel_pair_t pair = { { NULL, NULL }, NULL, 0 };
+    for (int i = 0; i < 2; i++) {
+        pair.pair[i] = dop_func_create_component(DOP_COMPONENT_TIMER);
+        dop_timer_set_duration(pair.pair[i], 1);
+        dop_timer_start(pair.pair[i]);
+    }
+    dop_timing_wheel_advance(dop_timing_wheel_default(), dop_time_monotonic_ms() + 10, destroy_partner, &pair);
+    assert(pair.seen == 1 && pair.survivor->wheel_entry.pins == 0);
+    dop_func_destroy_component(pair.survivor);
+    printf("Timing wheel test passed\n");
+}
+
+static void record_event(dop_component_t* component, dop_event_kind_t kind, void* context) {
+    assert(kind == DOP_EVENT_TIMER_EXPIRED);
+    *(dop_component_t**)context = component;
+}
+
+static void test_event_loop(void) {
+    printf("Testing event loop...\n");
+    
+    dop_event_loop_t* loop = dop_event_loop_create(NULL);
+    assert(loop != NULL);
+    assert(dop_event_loop_fd(loop) >= 0);
+    
+    dop_component_t* timer = dop_func_create_component(DOP_COMPONENT_TIMER);
+    dop_component_t* notified = NULL;
+    dop_subscription_t callback_id, fd_id;
+    int event_fd = -1;
+    assert(dop_event_subscribe(loop, &timer, 1, record_event, &notified, &callback_id) == DOP_SUCCESS);
+    assert(dop_event_subscribe_eventfd(loop, &timer, 1, &event_fd, &fd_id) == DOP_SUCCESS);
+    
+    // The loop sleeps in epoll until the timerfd reaches the deadline
+    dop_timer_set_duration(timer, 5);
+    dop_timer_start(timer);
+    size_t fired = 0;
+    while (fired == 0) {
+        assert(dop_event_loop_run_once(loop, 1000, &fired) == DOP_SUCCESS);
+    }
+    assert(fired == 1 && notified == timer);
+    assert(dop_timer_is_expired(timer));
+    
+    uint64_t counter = 0;
+    assert(read(event_fd, &counter, sizeof(counter)) == sizeof(counter) && counter == 1);
+    
+    // Unsubscribed and cancelled timers stay quiet
+    assert(dop_event_unsubscribe(loop, callback_id) == DOP_SUCCESS);
+    assert(dop_event_unsubscribe(loop, callback_id) == DOP_ERROR_INVALID_PARAMETER);
+    notified = NULL;
+    dop_timer_start(timer);
+    dop_timer_stop(timer);
+    assert(dop_event_loop_run_once(loop, 20, &fired) == DOP_SUCCESS);
+    assert(notified == NULL && !dop_timer_is_expired(timer));
+    
+    // Background thread delivers through the eventfd
+    assert(dop_event_loop_start(loop) == DOP_SUCCESS);
+    dop_timer_start(timer);
+    struct pollfd wait_fd = { .fd = event_fd, .events = POLLIN, .revents = 0 };
+    assert(poll(&wait_fd, 1, 1000) == 1);
+    assert(read(event_fd, &counter, sizeof(counter)) == sizeof(counter));
+    assert(dop_event_loop_stop(loop) == DOP_SUCCESS);
+    assert(dop_timer_is_expired(timer));
+    
+    dop_event_unsubscribe(loop, fd_id);
+    close(event_fd);
+    dop_func_destroy_component(timer);
+    dop_event_loop_destroy(loop);
+    printf("Event loop test passed\n");
+}
+
 int main(int argc, char* argv[]) {
     if (argc > 1 && strcmp(argv[1], "component") == 0) {
         test_alarm_component();
         test_clock_component();
+        test_component_store();
+        test_batched_update();
+        test_checksum_algorithms();
+        test_gate_bulk();
+        test_seqlock_readers();
+        test_cold_metadata();
+        test_slab_lifecycle();
+        test_component_registry();
+        test_wire_format();
+        test_clock_formatting();
+        test_packed_time();
+        test_time_source();
+        test_monotonic_durations();
+        test_timing_wheel();
+        test_event_loop();
+        test_tick_engine();
+        test_work_stealing_scheduler();
+        test_deadline_scheduler();
+        test_lap_history();
+        test_periodic_timer();
+        test_recurring_alarms();
+        test_timezone_tables();
+        test_change_journal();
+        test_store_snapshot();
         printf("All component tests passed!\n");
         return 0;
     }